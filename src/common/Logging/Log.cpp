@@ -30,7 +30,7 @@
 #include <chrono>
 #include <sstream>
 
-Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioContext(nullptr), _strand(nullptr)
+Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _generation(1), _ioContext(nullptr), _strand(nullptr)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
@@ -254,6 +254,13 @@ Logger const* Log::GetLoggerByType(std::string const& type) const
     return GetLoggerByType(parentLogger);
 }
 
+void Log::ResolveHandle(LogHandle& handle, char const* type, uint32 generation) const
+{
+    Logger const* logger = GetLoggerByType(type);
+    handle.level.store(logger ? logger->getLogLevel() : LOG_LEVEL_DISABLED, std::memory_order_relaxed);
+    handle.generation.store(generation, std::memory_order_release);
+}
+
 std::string Log::GetTimestampStr()
 {
     time_t tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
@@ -287,6 +294,7 @@ bool Log::SetLogLevel(std::string const& name, char const* newLevelc, bool isLog
             return false;
 
         it->second->setLogLevel(newLevel);
+        ++_generation;
 
         if (newLevel != LOG_LEVEL_DISABLED && newLevel < lowestLogLevel)
             lowestLogLevel = newLevel;
@@ -331,13 +339,12 @@ void Log::Close()
 {
     loggers.clear();
     appenders.clear();
+    ++_generation;
 }
 
 bool Log::ShouldLog(std::string const& type, LogLevel level) const
 {
-    // TODO: Use cache to store "Type.sub1.sub2": "Type" equivalence, should
-    // Speed up in cases where requesting "Type.sub1.sub2" but only configured
-    // Logger "Type"
+    // Filters known at compile time use the LogHandle overload, which caches the logger lookup
 
     // Don't even look for a logger if the LogLevel is lower than lowest log levels across all loggers
     if (level < lowestLogLevel)
@@ -388,4 +395,5 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+    ++_generation;
 }
@@ -24,6 +24,7 @@
 #include "LogCommon.h"
 #include "StringFormat.h"
 
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <vector>
@@ -50,6 +51,16 @@ Appender* CreateAppender(uint8 id, std::string const& name, LogLevel level, Appe
     return new AppenderImpl(id, name, level, flags, std::forward<std::vector<char const*>>(extraArgs));
 }
 
+/// Level of the logger a literal filter resolves to, cached by each TC_LOG_* call site.
+/// Resolved again when loggers are reloaded or a logger level is changed.
+struct LogHandle
+{
+    constexpr LogHandle() : generation(0), level(LOG_LEVEL_DISABLED) { }
+
+    std::atomic<uint32> generation;
+    std::atomic<uint8> level;
+};
+
 class TC_COMMON_API Log
 {
     typedef std::unordered_map<std::string, Logger> LoggerMap;
@@ -70,6 +81,18 @@ class TC_COMMON_API Log
         void LoadFromConfig();
         void Close();
         bool ShouldLog(std::string const& type, LogLevel level) const;
+        // Literal filter, the logger is only looked up again when loggers changed
+        template<size_t N>
+        bool ShouldLog(LogHandle& handle, char const (&type)[N], LogLevel level) const
+        {
+            uint32 generation = _generation.load(std::memory_order_acquire);
+            if (handle.generation.load(std::memory_order_acquire) != generation)
+                ResolveHandle(handle, type, generation);
+
+            LogLevel logLevel = LogLevel(handle.level.load(std::memory_order_relaxed));
+            return logLevel != LOG_LEVEL_DISABLED && logLevel <= level;
+        }
+        bool ShouldLog(LogHandle& /*handle*/, std::string const& type, LogLevel level) const { return ShouldLog(type, level); }
         bool SetLogLevel(std::string const& name, char const* level, bool isLogger = true);
 
         template<typename Format, typename... Args>
@@ -106,6 +129,7 @@ class TC_COMMON_API Log
         void write(std::unique_ptr<LogMessage>&& msg) const;
 
         Logger const* GetLoggerByType(std::string const& type) const;
+        void ResolveHandle(LogHandle& handle, char const* type, uint32 generation) const;
         Appender* GetAppenderByName(std::string const& name);
         uint8 NextAppenderId();
         void CreateAppenderFromConfig(std::string const& name);
@@ -121,6 +145,7 @@ class TC_COMMON_API Log
         std::unordered_map<std::string, std::unique_ptr<Logger>> loggers;
         uint8 AppenderId;
         LogLevel lowestLogLevel;
+        std::atomic<uint32> _generation; // changed each time loggers or their levels change, invalidates LogHandles
 
         std::string m_logsDir;
         std::string m_logsTimestamp;
@@ -151,7 +176,8 @@ void check_args(std::string const&, ...);
 // This will catch format errors on build time
 #define TC_LOG_MESSAGE_BODY(filterType__, level__, ...)                 \
         do {                                                            \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            static LogHandle logHandle__;                               \
+            if (sLog->ShouldLog(logHandle__, filterType__, level__))    \
             {                                                           \
                 if (false)                                              \
                     check_args(__VA_ARGS__);                            \
@@ -164,7 +190,8 @@ void check_args(std::string const&, ...);
         __pragma(warning(push))                                         \
         __pragma(warning(disable:4127))                                 \
         do {                                                            \
-            if (sLog->ShouldLog(filterType__, level__))                 \
+            static LogHandle logHandle__;                               \
+            if (sLog->ShouldLog(logHandle__, filterType__, level__))    \
                 LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
         } while (0)                                                     \
         __pragma(warning(pop))
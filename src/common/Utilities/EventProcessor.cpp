@@ -2,6 +2,8 @@
 #include "EventProcessor.h"
 #include "Errors.h"
 
+#include <algorithm>
+
 void BasicEvent::ScheduleAbort()
 {
     ASSERT(IsRunning()
@@ -34,12 +36,11 @@ void EventProcessor::Update(uint32 p_time)
     m_time += p_time;
 
     // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    while (!m_events.empty() && m_events.back().first <= m_time)
     {
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        BasicEvent* event = m_events.back().second;
+        m_events.pop_back();
 
         if (event->IsRunning())
         {
@@ -75,8 +76,10 @@ void EventProcessor::KillAllEvents(bool force)
     // prevent event insertions
     m_aborting = true;
 
-    // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    // first, abort all existing events, in execution order. Events are moved out of the list since Abort may add events.
+    EventList events;
+    events.swap(m_events);
+    for (auto itr = events.rbegin(); itr != events.rend(); ++itr)
     {
         // Abort events which weren't aborted already
         if (!itr->second->IsAborted())
@@ -89,21 +92,12 @@ void EventProcessor::KillAllEvents(bool force)
         // not forcing the event cancellation.
         if (!force && !itr->second->IsDeletable())
         {
-            ++itr;
+            InsertEvent(itr->second, itr->first);
             continue;
         }
 
         delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
     }
-
-    // fast clear event list (in force case)
-    if (force)
-        m_events.clear();
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime)
@@ -111,7 +105,17 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
     if (set_addtime)
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+    InsertEvent(Event, e_time);
+}
+
+void EventProcessor::InsertEvent(BasicEvent* event, uint64 e_time)
+{
+    // before events with the same time, so that those are executed first
+    auto itr = std::lower_bound(m_events.begin(), m_events.end(), e_time, [](EventList::value_type const& entry, uint64 time)
+    {
+        return entry.first > time;
+    });
+    m_events.insert(itr, EventList::value_type(e_time, event));
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* Event, uint64 newTime)
@@ -123,7 +127,7 @@ void EventProcessor::ModifyEventTime(BasicEvent* Event, uint64 newTime)
 
         Event->m_execTime = newTime;
         m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime, Event));
+        InsertEvent(Event, newTime);
         break;
     }
 }
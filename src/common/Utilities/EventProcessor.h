@@ -22,7 +22,7 @@
 #include "Define.h"
 #include "Random.h"
 
-#include <map>
+#include <vector>
 
 // Note. All times are in milliseconds here.
 
@@ -67,7 +67,12 @@ private:
         uint64 m_execTime;                                  // planned time of next execution, filled by event handler
 };
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
+/* Events sorted by descending execution time, the next event to execute is at the back. Events with the same time
+are executed in insertion order.
+A sorted vector is used instead of a multimap since most objects only hold a few events at once: it does not allocate
+a node per added event and keeps its capacity between events.
+*/
+typedef std::vector<std::pair<uint64, BasicEvent*>> EventList;
 
 class TC_COMMON_API EventProcessor
 {
@@ -78,6 +83,7 @@ class TC_COMMON_API EventProcessor
         ~EventProcessor();
 
         void Update(uint32 p_time);
+        bool Empty() const { return m_events.empty(); }
         void KillAllEvents(bool force);
         void AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime = true);
         void AddEventAtOffset(BasicEvent* event, Milliseconds offset) { AddEvent(event, CalculateTime(offset.count())); }
@@ -86,6 +92,8 @@ class TC_COMMON_API EventProcessor
         uint64 CalculateTime(uint64 t_offset) const;
         uint64 CalculateQueueTime(uint64 delay) const;
     protected:
+        void InsertEvent(BasicEvent* event, uint64 e_time);
+
         uint64 m_time;
         EventList m_events;
         bool m_aborting;
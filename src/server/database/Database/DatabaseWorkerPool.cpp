@@ -316,6 +316,12 @@ void DatabaseWorkerPool<T>::EscapeString(std::string& str)
     delete[] buf;
 }
 
+template <class T>
+size_t DatabaseWorkerPool<T>::QueueSize() const
+{
+    return _queue->Size();
+}
+
 template <class T>
 void DatabaseWorkerPool<T>::KeepAlive()
 {
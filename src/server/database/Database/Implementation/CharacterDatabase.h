@@ -143,8 +143,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_ITEM_BOP_TRADE,
     CHAR_DEL_ITEM_BOP_TRADE,
     CHAR_INS_ITEM_BOP_TRADE,
-    CHAR_REP_INVENTORY_ITEM,
     */
+    CHAR_REP_INVENTORY_ITEM,
     CHAR_SEL_ITEM_INSTANCE,
     CHAR_REP_ITEM_INSTANCE,
     CHAR_UPD_ITEM_INSTANCE,
@@ -468,9 +468,9 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHAR_ACHIEVEMENT_BY_ACHIEVEMENT,
     CHAR_UPD_CHAR_ACHIEVEMENT,
     CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE,
-    CHAR_DEL_CHAR_SPELL_BY_SPELL,
     CHAR_UPD_CHAR_SPELL_FACTION_CHANGE,
     */
+    CHAR_DEL_CHAR_SPELL_BY_SPELL,
     CHAR_DEL_CHAR_QUESTSTATUS,
     CHAR_SEL_CHAR_REP_BY_FACTION,
     CHAR_DEL_CHAR_REP_BY_FACTION,
@@ -527,10 +527,10 @@ enum CharacterDatabaseStatements : uint32
     CHAR_DEL_CHAR_SKILL_BY_SKILL,
     CHAR_INS_CHAR_SKILLS,
     CHAR_UPD_CHAR_SKILLS,
-    CHAR_INS_CHAR_SPELL,
     CHAR_DEL_CHAR_STATS,
     CHAR_INS_CHAR_STATS,
     */
+    CHAR_INS_CHAR_SPELL,
     CHAR_DEL_PETITION_BY_OWNER,
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER,
     CHAR_DEL_PETITION_BY_OWNER_AND_TYPE,
@@ -35,6 +35,9 @@
 #include <mysql.h>
 #include <mysqld_error.h>
 
+//- Max rows merged into a single multi-row INSERT/REPLACE, keeps queries well below max_allowed_packet
+#define MAX_BATCH_ROWS 256
+
 MySQLConnectionInfo::MySQLConnectionInfo(std::string const& infoString)
 {
     Tokenizer tokens(infoString, ';');
@@ -245,6 +248,23 @@ bool MySQLConnection::Execute(PreparedStatement* stmt)
     return true;
 }
 
+bool MySQLConnection::ExecuteBatch(MySQLPreparedStatement* mStmt, SQLElementData const* rows, std::size_t count)
+{
+    if (!m_Mysql)
+        return false;
+
+    std::string query(mStmt->getBatchPrefix());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i)
+            query += ',';
+
+        mStmt->AppendBatchRow(query, rows[i].element.stmt, m_Mysql);
+    }
+
+    return Execute(query.c_str());
+}
+
 bool MySQLConnection::_Query(PreparedStatement* stmt, MYSQL_RES **pResult, uint64* pRowCount, uint32* pFieldCount)
 {
     if (!m_Mysql)
@@ -388,13 +408,26 @@ int MySQLConnection::ExecuteTransaction(SQLTransaction& transaction)
             {
                 PreparedStatement* stmt = data.element.stmt;
                 ASSERT(stmt);
-                if (!Execute(stmt))
+
+                // merge consecutive rows of the same INSERT/REPLACE into one multi-row query
+                std::size_t batchSize = 1;
+                MySQLPreparedStatement* mStmt = GetPreparedStatement(stmt->m_index);
+                if (mStmt && mStmt->CanBatch())
+                {
+                    for (auto next = itr + 1; next != queries.end() && batchSize < MAX_BATCH_ROWS; ++next, ++batchSize)
+                        if (next->type != SQL_ELEMENT_PREPARED || next->element.stmt->m_index != stmt->m_index)
+                            break;
+                }
+
+                if (!(batchSize > 1 ? ExecuteBatch(mStmt, &data, batchSize) : Execute(stmt)))
                 {
                     TC_LOG_WARN("sql.sql", "Transaction aborted. %u queries not executed.", (uint32)queries.size());
                     int errorCode = GetLastError();
                     RollbackTransaction();
                     return errorCode;
                 }
+
+                itr += batchSize - 1;
             }
             break;
             case SQL_ELEMENT_RAW:
@@ -32,6 +32,7 @@ class ProducerConsumerQueue;
 class DatabaseWorker;
 class MySQLPreparedStatement;
 class SQLOperation;
+struct SQLElementData;
 
 enum ConnectionFlags
 {
@@ -69,6 +70,7 @@ class TC_DATABASE_API MySQLConnection
     public:
         bool Execute(char const* sql);
         bool Execute(PreparedStatement* stmt);
+        bool ExecuteBatch(MySQLPreparedStatement* mStmt, SQLElementData const* rows, std::size_t count);
         ResultSet* Query(char const* sql);
         PreparedResultSet* Query(PreparedStatement* stmt);
         bool _Query(char const* sql, MYSQL_RES** pResult, MYSQL_FIELD** pFields, uint64* pRowCount, uint32* pFieldCount);
@@ -24,6 +24,9 @@
 #include <winsock2.h>
 #endif
 #include <mysql.h>
+#include <algorithm>
+#include <iomanip>
+#include <limits>
 #include <sstream>
 
 PreparedStatement::PreparedStatement(uint32 index, uint8 capacity) :
@@ -190,6 +193,50 @@ void PreparedStatement::setNull(const uint8 index)
     statement_data[index].type = TYPE_NULL;
 }
 
+//- Splits a single row "INSERT/REPLACE ... VALUES (?, ...)" query into its prefix and row template.
+//- Both are left empty for any other query form (INSERT ... SELECT, ON DUPLICATE KEY UPDATE, ...)
+static void SplitBatchTemplate(std::string const& query, uint32 paramCount, std::string& prefix, std::string& row)
+{
+    if (!paramCount)
+        return;
+
+    std::string upper(query);
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+    if (upper.compare(0, 6, "INSERT") != 0 && upper.compare(0, 7, "REPLACE") != 0)
+        return;
+
+    if (upper.find("SELECT") != std::string::npos || upper.find("ON DUPLICATE") != std::string::npos)
+        return;
+
+    size_t valuesPos = upper.rfind("VALUES");
+    if (valuesPos == std::string::npos)
+        return;
+
+    size_t rowStart = query.find_first_not_of(" \t\r\n", valuesPos + 6);
+    if (rowStart == std::string::npos || query[rowStart] != '(')
+        return;
+
+    size_t rowEnd = std::string::npos;
+    int32 depth = 0;
+    for (size_t i = rowStart; i < query.size() && rowEnd == std::string::npos; ++i)
+    {
+        if (query[i] == '(')
+            ++depth;
+        else if (query[i] == ')' && --depth == 0)
+            rowEnd = i;
+    }
+
+    // the row must end the query and hold every parameter
+    if (rowEnd == std::string::npos || query.find_first_not_of(" \t\r\n;", rowEnd + 1) != std::string::npos)
+        return;
+
+    if (std::count(query.begin(), query.begin() + rowStart, '?') != 0 || uint32(std::count(query.begin() + rowStart, query.end(), '?')) != paramCount)
+        return;
+
+    prefix = query.substr(0, rowStart);
+    row = query.substr(rowStart, rowEnd - rowStart + 1);
+}
+
 MySQLPreparedStatement::MySQLPreparedStatement(MYSQL_STMT* stmt, std::string queryString) :
 m_stmt(nullptr), m_Mstmt(stmt), m_bind(nullptr), m_queryString(std::move(queryString))
 {
@@ -202,6 +249,8 @@ m_stmt(nullptr), m_Mstmt(stmt), m_bind(nullptr), m_queryString(std::move(querySt
     /// "If set to 1, causes mysql_stmt_store_result() to update the metadata MYSQL_FIELD->max_length value."
     my_bool bool_tmp = 1;
     mysql_stmt_attr_set(stmt, STMT_ATTR_UPDATE_MAX_LENGTH, &bool_tmp);
+
+    SplitBatchTemplate(m_queryString, m_paramCount, m_batchPrefix, m_batchRow);
 }
 
 MySQLPreparedStatement::~MySQLPreparedStatement()
@@ -441,6 +490,89 @@ std::string MySQLPreparedStatement::getQueryString() const
     return queryString;
 }
 
+//- Appends the row template with the values bound to stmt, escaped for the given connection
+void MySQLPreparedStatement::AppendBatchRow(std::string& query, PreparedStatement const* stmt, MYSQL* mysql) const
+{
+    static char const hexDigits[] = "0123456789ABCDEF";
+
+    uint32 param = 0;
+    for (char c : m_batchRow)
+    {
+        if (c != '?')
+        {
+            query += c;
+            continue;
+        }
+
+        PreparedStatementData const& data = stmt->statement_data[param++];
+        switch (data.type)
+        {
+            case TYPE_BOOL:
+                query += data.data.boolean ? '1' : '0';
+                break;
+            case TYPE_UI8:
+                query += std::to_string(data.data.ui8);
+                break;
+            case TYPE_UI16:
+                query += std::to_string(data.data.ui16);
+                break;
+            case TYPE_UI32:
+                query += std::to_string(data.data.ui32);
+                break;
+            case TYPE_UI64:
+                query += std::to_string(data.data.ui64);
+                break;
+            case TYPE_I8:
+                query += std::to_string(data.data.i8);
+                break;
+            case TYPE_I16:
+                query += std::to_string(data.data.i16);
+                break;
+            case TYPE_I32:
+                query += std::to_string(data.data.i32);
+                break;
+            case TYPE_I64:
+                query += std::to_string(data.data.i64);
+                break;
+            case TYPE_FLOAT:
+            case TYPE_DOUBLE:
+            {
+                // keep the exact value, as a bound parameter would
+                std::ostringstream ss;
+                if (data.type == TYPE_FLOAT)
+                    ss << std::setprecision(std::numeric_limits<float>::max_digits10) << data.data.f;
+                else
+                    ss << std::setprecision(std::numeric_limits<double>::max_digits10) << data.data.d;
+                query += ss.str();
+                break;
+            }
+            case TYPE_STRING:
+            {
+                // binary holds the terminating null character
+                unsigned long length = data.binary.empty() ? 0 : static_cast<unsigned long>(data.binary.size() - 1);
+                std::vector<char> escaped(length * 2 + 1);
+                length = mysql_real_escape_string(mysql, escaped.data(), reinterpret_cast<char const*>(data.binary.data()), length);
+                query += '\'';
+                query.append(escaped.data(), length);
+                query += '\'';
+                break;
+            }
+            case TYPE_BINARY:
+                query += "X'";
+                for (uint8 byte : data.binary)
+                {
+                    query += hexDigits[byte >> 4];
+                    query += hexDigits[byte & 0xF];
+                }
+                query += '\'';
+                break;
+            case TYPE_NULL:
+                query += "NULL";
+                break;
+        }
+    }
+}
+
 //- Execution
 PreparedStatementTask::PreparedStatementTask(PreparedStatement* stmt, bool async) :
 m_stmt(stmt), m_result(nullptr)
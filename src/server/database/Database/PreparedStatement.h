@@ -98,6 +98,8 @@ class TC_DATABASE_API PreparedStatement
         void setString(const uint8 index, const std::string& value);
         void setBinary(const uint8 index, const std::vector<uint8>& value);
 
+        uint32 GetIndex() const { return m_index; }
+
     protected:
         void BindParameters(MySQLPreparedStatement* stmt);
 
@@ -140,6 +142,9 @@ class TC_DATABASE_API MySQLPreparedStatement
 
         uint32 GetParameterCount() const { return m_paramCount; }
 
+        //- True for single row "INSERT/REPLACE ... VALUES (...)" queries, rows of which can be merged into one multi-row query
+        bool CanBatch() const { return !m_batchRow.empty(); }
+
     protected:
         MYSQL_STMT* GetSTMT() { return m_Mstmt; }
         MYSQL_BIND* GetBind() { return m_bind; }
@@ -147,6 +152,8 @@ class TC_DATABASE_API MySQLPreparedStatement
         void ClearParameters();
         void AssertValidIndex(uint8 index);
         std::string getQueryString() const;
+        std::string const& getBatchPrefix() const { return m_batchPrefix; }
+        void AppendBatchRow(std::string& query, PreparedStatement const* stmt, MYSQL* mysql) const;
 
     private:
         MYSQL_STMT* m_Mstmt;
@@ -154,6 +161,8 @@ class TC_DATABASE_API MySQLPreparedStatement
         std::vector<bool> m_paramsSet;
         MYSQL_BIND* m_bind;
         std::string const m_queryString;
+        std::string m_batchPrefix;                          //- query up to VALUES, empty if not batchable
+        std::string m_batchRow;                             //- "(?, ?, ...)" row template
 
         MySQLPreparedStatement(MySQLPreparedStatement const& right) = delete;
         MySQLPreparedStatement& operator=(MySQLPreparedStatement const& right) = delete;
@@ -86,17 +86,16 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, const SpellInfo* spell, GameObject* gob)
 {
-    for (auto& mEvent : mEvents)
-    {
-        SMART_EVENT eventType = SMART_EVENT(mEvent.GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+    if (e >= SMART_EVENT_END || e == SMART_EVENT_LINK) //links get special handling
+        return;
 
-        if (eventType == e)
-        {
-            if (sConditionMgr->IsObjectMeetingSmartEventConditions(mEvent.entryOrGuid, mEvent.event_id, mEvent.source_type, unit, GetBaseObject()))
-                ProcessEvent(mEvent, unit, var0, var1, bvar, spell, gob);
-        }
+    // events may be added while processing, iterate by index
+    std::vector<uint32> const& eventIndexes = mEventsByType[e];
+    for (size_t i = 0; i < eventIndexes.size(); ++i)
+    {
+        SmartScriptHolder& mEvent = mEvents[eventIndexes[i]];
+        if (sConditionMgr->IsObjectMeetingSmartEventConditions(mEvent.entryOrGuid, mEvent.event_id, mEvent.source_type, unit, GetBaseObject()))
+            ProcessEvent(mEvent, unit, var0, var1, bvar, spell, gob);
     }
 }
 
@@ -4073,55 +4072,62 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
         }
 
         e.active = true;//activate events with cooldown
-        switch (e.GetEventType())//process ONLY timed events
-        {
-            case SMART_EVENT_UPDATE:
-            case SMART_EVENT_UPDATE_OOC:
-            case SMART_EVENT_UPDATE_IC:
-            case SMART_EVENT_HEALT_PCT:
-            case SMART_EVENT_TARGET_HEALTH_PCT:
-            case SMART_EVENT_MANA_PCT:
-            case SMART_EVENT_TARGET_MANA_PCT:
-            case SMART_EVENT_RANGE:
-            case SMART_EVENT_VICTIM_CASTING:
-            case SMART_EVENT_FRIENDLY_HEALTH:
-            case SMART_EVENT_FRIENDLY_IS_CC:
-            case SMART_EVENT_FRIENDLY_MISSING_BUFF:
-            case SMART_EVENT_HAS_AURA:
-            case SMART_EVENT_TARGET_BUFFED:
-            case SMART_EVENT_IS_BEHIND_TARGET:
-            case SMART_EVENT_FRIENDLY_HEALTH_PCT:
-            case SMART_EVENT_DISTANCE_CREATURE:
-            case SMART_EVENT_DISTANCE_GAMEOBJECT:
-            case SMART_EVENT_VICTIM_NOT_IN_LOS:
-            case SMART_EVENT_AFFECTED_BY_MECHANIC:
-            {
-                if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+        if (IsTimedEventType(e.GetEventType()))//process ONLY timed events
+        {
+            if (e.GetScriptType() == SMART_SCRIPT_TYPE_TIMED_ACTIONLIST)
+            {
+                Unit* invoker = nullptr;
+                if (me && mTimedActionListInvoker)
+                    invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
+                ProcessEvent(e, invoker);
+                e.enableTimed = false;//disable event if it is in an ActionList and was processed once
+                for (auto & i : mTimedActionList)
                 {
-                    Unit* invoker = nullptr;
-                    if (me && mTimedActionListInvoker)
-                        invoker = ObjectAccessor::GetUnit(*me, mTimedActionListInvoker);
-                    ProcessEvent(e, invoker);
-                    e.enableTimed = false;//disable event if it is in an ActionList and was processed once
-                    for (auto & i : mTimedActionList)
+                    //find the first event which is not the current one and enable it
+                    if (i.event_id > e.event_id)
                     {
-                        //find the first event which is not the current one and enable it
-                        if (i.event_id > e.event_id)
-                        {
-                            i.enableTimed = true;
-                            break;
-                        }
+                        i.enableTimed = true;
+                        break;
                     }
-                } else 
-                    ProcessEvent(e);
-                break;
-            }
+                }
+            } else 
+                ProcessEvent(e);
         }
     }
     else
         e.timer -= diff;
 }
 
+bool SmartScript::IsTimedEventType(uint32 eventType)
+{
+    switch (eventType)
+    {
+        case SMART_EVENT_UPDATE:
+        case SMART_EVENT_UPDATE_OOC:
+        case SMART_EVENT_UPDATE_IC:
+        case SMART_EVENT_HEALT_PCT:
+        case SMART_EVENT_TARGET_HEALTH_PCT:
+        case SMART_EVENT_MANA_PCT:
+        case SMART_EVENT_TARGET_MANA_PCT:
+        case SMART_EVENT_RANGE:
+        case SMART_EVENT_VICTIM_CASTING:
+        case SMART_EVENT_FRIENDLY_HEALTH:
+        case SMART_EVENT_FRIENDLY_IS_CC:
+        case SMART_EVENT_FRIENDLY_MISSING_BUFF:
+        case SMART_EVENT_HAS_AURA:
+        case SMART_EVENT_TARGET_BUFFED:
+        case SMART_EVENT_IS_BEHIND_TARGET:
+        case SMART_EVENT_FRIENDLY_HEALTH_PCT:
+        case SMART_EVENT_DISTANCE_CREATURE:
+        case SMART_EVENT_DISTANCE_GAMEOBJECT:
+        case SMART_EVENT_VICTIM_NOT_IN_LOS:
+        case SMART_EVENT_AFFECTED_BY_MECHANIC:
+            return true;
+        default:
+            return false;
+    }
+}
+
 bool SmartScript::CheckTimer(SmartScriptHolder const& e) const
 {
     return e.active;
@@ -4132,7 +4138,7 @@ void SmartScript::InstallEvents()
     if (!mInstallEvents.empty())
     {
         for (auto & mInstallEvent : mInstallEvents)
-            mEvents.push_back(mInstallEvent);//must be before UpdateTimers
+            AddEvent(mInstallEvent);//must be before UpdateTimers
 
         mInstallEvents.clear();
     }
@@ -4197,7 +4203,13 @@ void SmartScript::OnUpdate(uint32 const diff)
     InstallEvents();//before UpdateTimers
 
     for (auto & mEvent : mEvents)
+    {
+        // nothing to do for an untimed event without cooldown running
+        if (mEvent.active && !mEvent.timer && !IsTimedEventType(mEvent.GetEventType()))
+            continue;
+
         UpdateTimer(mEvent, diff);
+    }
 
     if (!mStoredEvents.empty())
     {
@@ -4271,18 +4283,25 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTriggerEn
             if(obj && obj->GetMap()->IsDungeon())
             {
                 if ((1 << (obj->GetMap()->GetSpawnMode()+1)) & i.event.event_flags)
-                    mEvents.push_back(i);
+                    AddEvent(i);
             } else {
                 //if out of instance, still play "normal" difficulty events
                 if(i.event.event_flags & SMART_EVENT_FLAG_DIFFICULTY_0)
-                    mEvents.push_back(i);
+                    AddEvent(i);
             }
             continue;
         }
-        mEvents.push_back(i);//NOTE: 'world(0)' events still get processed in ANY instance mode
+        AddEvent(i);//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
 }
 
+void SmartScript::AddEvent(SmartScriptHolder const& e)
+{
+    mEvents.push_back(e);
+    if (e.GetEventType() < SMART_EVENT_END)
+        mEventsByType[e.GetEventType()].push_back(mEvents.size() - 1);
+}
+
 void SmartScript::GetScript()
 {
     SmartAIEventList e;
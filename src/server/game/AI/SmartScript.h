@@ -13,6 +13,8 @@
 
 #include "SmartScriptMgr.h"
 
+#include <array>
+
 class TC_GAME_API SmartScript
 {
     public:
@@ -29,6 +31,8 @@ class TC_GAME_API SmartScript
         void RecalcTimer(SmartScriptHolder& e, uint32 min, uint32 max);
         void UpdateTimer(SmartScriptHolder& e, uint32 const diff);
         void InitTimer(SmartScriptHolder& e);
+        // Events processed from UpdateTimer when their timer expires, other events only use their timer as cooldown
+        static bool IsTimedEventType(uint32 eventType);
         void ProcessAction(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, const SpellInfo* spell = nullptr, GameObject* gob = nullptr);
         void ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, const SpellInfo* spell = nullptr, GameObject* gob = nullptr);
         /* Strips the list depending on the given target flags and the target type
@@ -216,7 +220,10 @@ class TC_GAME_API SmartScript
         void SetPhase(uint32 p = 0);
         void SetTemplatePhase(uint32 p = 0);
 
+        void AddEvent(SmartScriptHolder const& e);
+
         SmartAIEventList mEvents;
+        std::array<std::vector<uint32>, SMART_EVENT_END> mEventsByType; // indexes in mEvents per event type, so that ProcessEventsFor only visits events of the processed type
         SmartAIEventList mInstallEvents;
         SmartAIEventList mTimedActionList;
         ObjectGuid mTimedActionListInvoker;
@@ -46,6 +46,33 @@ AuctionHouseObject * AuctionHouseMgr::GetAuctionsMap( uint32 factionTemplateId )
         return &mNeutralAuctions;
 }
 
+std::wstring const& AuctionHouseMgr::GetItemSearchName(ItemTemplate const* proto, LocaleConstant locale)
+{
+    auto itr = _itemSearchNames[locale].find(proto->ItemId);
+    if (itr != _itemSearchNames[locale].end())
+        return itr->second;
+
+    std::wstring& searchName = _itemSearchNames[locale][proto->ItemId];
+    std::string name = proto->Name1;
+    if (locale != DEFAULT_LOCALE)
+        if (ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId))
+            if (il->Name.size() > size_t(locale) && !il->Name[locale].empty())
+                name = il->Name[locale];
+
+    if (Utf8toWStr(name, searchName))
+        wstrToLower(searchName);
+    else
+        searchName.clear();
+
+    return searchName;
+}
+
+void AuctionHouseMgr::ClearItemSearchNames()
+{
+    for (auto& searchNames : _itemSearchNames)
+        searchNames.clear();
+}
+
 uint32 AuctionHouseMgr::GetAuctionDeposit(AuctionHouseEntry const* entry, uint32 time, Item *pItem)
 {
     uint32 MSV = pItem->GetTemplate()->SellPrice;
@@ -477,10 +504,10 @@ void AuctionHouseObject::Update()
             ///- In any case clear the auction
             itr->second->DeleteFromDB(trans);
 
-            sAuctionMgr->RemoveAItem(itr->second->itemGUIDLow);
-            delete itr->second;
-            itr->second = nullptr;
-            RemoveAuction(itr->first);
+            AuctionEntry* auction = itr->second;
+            sAuctionMgr->RemoveAItem(auction->itemGUIDLow);
+            RemoveAuction(auction->Id);
+            delete auction;
         }
     }
     if(trans->GetSize()) //Sun: don't commit empty transaction
@@ -515,15 +542,44 @@ void AuctionHouseObject::RemoveAllAuctionsOf(SQLTransaction& trans, ObjectGuid::
             ///- In any case clear the auction
             itr->second->DeleteFromDB(trans);
 
-            sAuctionMgr->RemoveAItem(itr->second->itemGUIDLow);
-            delete itr->second;
-            itr->second = nullptr;
-
-            RemoveAuction(itr->first);
+            AuctionEntry* auction = itr->second;
+            sAuctionMgr->RemoveAItem(auction->itemGUIDLow);
+            RemoveAuction(auction->Id);
+            delete auction;
         }
     }
 }
 
+void AuctionHouseObject::AddAuction(AuctionEntry* ah)
+{
+    ASSERT(ah);
+    AuctionsMap[ah->Id] = ah;
+
+    if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(ah->itemEntry))
+    {
+        ItemClassAuctions& classAuctions = AuctionsByItemClass[proto->Class];
+        classAuctions.Auctions[ah->Id] = ah;
+        classAuctions.AuctionsBySubClass[proto->SubClass][ah->Id] = ah;
+    }
+}
+
+bool AuctionHouseObject::RemoveAuction(uint32 id)
+{
+    auto itr = AuctionsMap.find(id);
+    if (itr == AuctionsMap.end())
+        return false;
+
+    if (ItemTemplate const* proto = sObjectMgr->GetItemTemplate(itr->second->itemEntry))
+    {
+        ItemClassAuctions& classAuctions = AuctionsByItemClass[proto->Class];
+        classAuctions.Auctions.erase(id);
+        classAuctions.AuctionsBySubClass[proto->SubClass].erase(id);
+    }
+
+    AuctionsMap.erase(itr);
+    return true;
+}
+
 void AuctionHouseObject::BuildListBidderItems(WorldPacket& data, Player* player, uint32& count, uint32& totalcount)
 {
     for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin();itr != AuctionsMap.end();++itr)
@@ -572,16 +628,32 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
     uint32 inventoryType, uint32 itemClass, uint32 itemSubClass, uint32 quality,
     uint32& count, uint32& totalcount)
 {
-    for (AuctionEntryMap::const_iterator itr = AuctionsMap.begin();itr != AuctionsMap.end();++itr)
+    AuctionEntryMap const* auctions = &AuctionsMap;
+    if (itemClass != (0xffffffff))
     {
-        AuctionEntry *Aentry = itr->second;
-        Item *item = sAuctionMgr->GetAItem(Aentry->itemGUIDLow);
-        if (!item)
-            continue;
+        auto classItr = AuctionsByItemClass.find(itemClass);
+        if (classItr == AuctionsByItemClass.end())
+            return;
+
+        auctions = &classItr->second.Auctions;
+        if (itemSubClass != (0xffffffff))
+        {
+            auto subClassItr = classItr->second.AuctionsBySubClass.find(itemSubClass);
+            if (subClassItr == classItr->second.AuctionsBySubClass.end())
+                return;
 
-        ItemTemplate const *proto = item->GetTemplate();
+            auctions = &subClassItr->second;
+        }
+    }
 
-        if (itemClass != (0xffffffff) && proto->Class != itemClass)
+    LocaleConstant locale = player->GetSession()->GetSessionDbLocaleIndex();
+    for (AuctionEntryMap::const_iterator itr = auctions->begin();itr != auctions->end();++itr)
+    {
+        AuctionEntry *Aentry = itr->second;
+
+        // filter on template first, item is only needed for matching auctions
+        ItemTemplate const *proto = sObjectMgr->GetItemTemplate(Aentry->itemEntry);
+        if (!proto)
             continue;
 
         if (itemSubClass != (0xffffffff) && proto->SubClass != itemSubClass)
@@ -598,14 +670,18 @@ void AuctionHouseObject::BuildListAuctionItems(WorldPacket& data, Player* player
           )
             continue;
 
-        if( usable != (0x00) && player->CanUseItem( item ) != EQUIP_ERR_OK )
+        std::wstring const& name = sAuctionMgr->GetItemSearchName(proto, locale);
+        if(name.empty())
             continue;
 
-        std::string name = player->GetSession()->GetLocalizedItemName(proto);
-        if(name.empty())
+        if( !wsearchedname.empty() && name.find(wsearchedname) == std::wstring::npos )
             continue;
 
-        if( !wsearchedname.empty() && !Utf8FitTo(name, wsearchedname) )
+        Item *item = sAuctionMgr->GetAItem(Aentry->itemGUIDLow);
+        if (!item)
+            continue;
+
+        if( usable != (0x00) && player->CanUseItem( item ) != EQUIP_ERR_OK )
             continue;
 
         if ((count < 50) && (totalcount >= listfrom))
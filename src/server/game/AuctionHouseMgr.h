@@ -4,6 +4,7 @@
 class Item;
 class Player;
 class WorldPacket;
+struct ItemTemplate;
 
 #define MIN_AUCTION_TIME (12*HOUR)
 #define MAX_AUCTIONS 240
@@ -83,11 +84,7 @@ class AuctionHouseObject
     AuctionEntryMap::iterator GetAuctionsBegin() {return AuctionsMap.begin();}
     AuctionEntryMap::iterator GetAuctionsEnd() {return AuctionsMap.end();}
 
-    void AddAuction(AuctionEntry *ah)
-    {
-        ASSERT( ah );
-        AuctionsMap[ah->Id] = ah;
-    }
+    void AddAuction(AuctionEntry *ah);
 
     AuctionEntry* GetAuction(uint32 id) const
     {
@@ -95,10 +92,8 @@ class AuctionHouseObject
         return itr != AuctionsMap.end() ? itr->second : nullptr;
     }
 
-    bool RemoveAuction(uint32 id)
-    {
-        return AuctionsMap.erase(id) ? true : false;
-    }
+    // Auction must still be valid when removed, so that it can be found in indexes
+    bool RemoveAuction(uint32 id);
     
     void RemoveAllAuctionsOf(SQLTransaction& trans, ObjectGuid::LowType ownerGUID);
 
@@ -114,6 +109,13 @@ class AuctionHouseObject
 
   private:
     AuctionEntryMap AuctionsMap;
+    // Same auctions indexed by item class and subclass, most searches are done on a single class and often on a single subclass
+    struct ItemClassAuctions
+    {
+        AuctionEntryMap Auctions;
+        std::unordered_map<uint32 /*itemSubClass*/, AuctionEntryMap> AuctionsBySubClass;
+    };
+    std::unordered_map<uint32 /*itemClass*/, ItemClassAuctions> AuctionsByItemClass;
 };
 
 class TC_GAME_API AuctionHouseMgr
@@ -151,6 +153,11 @@ class TC_GAME_API AuctionHouseMgr
         void SendAuctionOutbiddedMail(AuctionEntry * auction, uint32 newPrice, Player* newBidder, SQLTransaction& trans);
         void SendAuctionCancelledToBidderMail(AuctionEntry* auction, SQLTransaction& trans);
 
+        // Lower case item name in given locale, as compared to search strings. Empty if item has no name.
+        std::wstring const& GetItemSearchName(ItemTemplate const* proto, LocaleConstant locale);
+        // Must be called after item names are reloaded
+        void ClearItemSearchNames();
+
         static uint32 GetAuctionDeposit(AuctionHouseEntry const* entry, uint32 time, Item *pItem);
         static AuctionHouseEntry const* GetAuctionHouseEntry(uint32 factionTemplateId);
         void RemoveAllAuctionsOf(SQLTransaction& trans, ObjectGuid::LowType ownerGUID);
@@ -171,6 +178,8 @@ class TC_GAME_API AuctionHouseMgr
       AuctionHouseObject mNeutralAuctions;
 
       ItemMap mAitems;
+
+      std::unordered_map<uint32 /*itemId*/, std::wstring> _itemSearchNames[TOTAL_LOCALES];
 };
 
 #define sAuctionMgr AuctionHouseMgr::instance()
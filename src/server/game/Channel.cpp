@@ -135,6 +135,7 @@ void Channel::Join(ObjectGuid p, const char *pass)
 
     PlayerInfo pinfo;
     pinfo.player = p;
+    pinfo.playerObject = plr;
     pinfo.flags = 0;
     pinfo.invisible = (plr ? plr->GetSession()->GetSecurity() > SEC_PLAYER : false) && sWorld->getConfig(CONFIG_SILENTLY_GM_JOIN_TO_CHANNEL);
     players[p] = pinfo;
@@ -708,11 +709,19 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
     }
 }
 
+Player* Channel::GetMemberPlayer(PlayerInfo const& info) const
+{
+    if (!info.playerObject)
+        return ObjectAccessor::FindPlayer(info.player);
+
+    return info.playerObject->IsInWorld() ? info.playerObject : nullptr;
+}
+
 void Channel::SendToAll(WorldPacket *data, ObjectGuid p)
 {
     for(auto & player : players)
     {
-        Player *plr = ObjectAccessor::FindPlayer(player.first);
+        Player *plr = GetMemberPlayer(player.second);
         if(plr)
         {
             if(!p || !plr->GetSocial()->HasIgnore(p.GetCounter()))
@@ -727,7 +736,7 @@ void Channel::SendToAllButOne(WorldPacket *data, ObjectGuid who)
     {
         if(player.first != who)
         {
-            Player *plr = ObjectAccessor::FindPlayer(player.first);
+            Player *plr = GetMemberPlayer(player.second);
             if(plr)
                 plr->SendDirectMessage(data);
         }
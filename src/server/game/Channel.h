@@ -101,8 +101,9 @@ class TC_GAME_API Channel
     struct PlayerInfo
     {
         ObjectGuid player;
-        uint8 flags;
-        bool invisible;
+        Player* playerObject = nullptr;     // set if online when joining, players leave all their channels when logging out
+        uint8 flags = 0;
+        bool invisible = false;
 
         bool HasFlag(uint8 flag) { return flags & flag; }
         void SetFlag(uint8 flag) { if(!HasFlag(flag)) flags |= flag; }
@@ -181,6 +182,8 @@ class TC_GAME_API Channel
         void MakeVoiceOn(WorldPacket *data, ObjectGuid guid);                   //+ 0x22
         void MakeVoiceOff(WorldPacket *data, ObjectGuid guid);                  //+ 0x23
 
+        // Member player if in world, without global lookup when known
+        Player* GetMemberPlayer(PlayerInfo const& info) const;
         void SendToAllButOne(WorldPacket *data, ObjectGuid who);
         void SendToOne(WorldPacket *data, ObjectGuid who);
 
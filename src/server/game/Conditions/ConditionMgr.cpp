@@ -843,48 +843,52 @@ uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionContainer cons
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
+    // The list is met if all conditions of any else group are met. Since groups are contiguous, stop at the first
+    // group fully met and skip the rest of a group once one of its conditions failed.
+    bool groupStarted = false;
+    bool groupMet = false;
+    uint32 elseGroup = 0;
     for (auto condition : conditions)
     {
-        TC_LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditionList %s val1: %u", condition->ToString().c_str(), condition->ConditionValue1);
-        if (condition->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find(condition->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[condition->ElseGroup] = true;
-            else if (!(*itr).second) //! If another condition in this group was unmatched before this, don't bother checking (the group is false anyway)
-                continue;
+        if (!condition->isLoaded())
+            continue;
 
-            if (condition->ReferenceId)//handle reference
-            {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[condition->ElseGroup] = false;
-                }
-                else
-                {
-                    TC_LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditionList %s Reference template -%u not found",
-                        condition->ToString().c_str(), condition->ReferenceId); // checked at loading, should never happen
-                }
+        if (!groupStarted || condition->ElseGroup != elseGroup)
+        {
+            if (groupMet)
+                return true;
 
+            DEBUG_ASSERT(!groupStarted || condition->ElseGroup > elseGroup);
+            groupStarted = true;
+            groupMet = true;
+            elseGroup = condition->ElseGroup;
+        }
+        else if (!groupMet) //! If another condition in this group was unmatched before this, don't bother checking (the group is false anyway)
+            continue;
+
+        TC_LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditionList %s val1: %u", condition->ToString().c_str(), condition->ConditionValue1);
+        if (condition->ReferenceId)//handle reference
+        {
+            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(condition->ReferenceId);
+            if (ref != ConditionReferenceStore.end())
+            {
+                if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
+                    groupMet = false;
             }
-            else //handle normal condition
+            else
             {
-                if (!condition->Meets(sourceInfo))
-                    ElseGroupStore[condition->ElseGroup] = false;
+                TC_LOG_DEBUG("condition", "ConditionMgr::IsObjectMeetToConditionList %s Reference template -%u not found",
+                    condition->ToString().c_str(), condition->ReferenceId); // checked at loading, should never happen
             }
         }
+        else //handle normal condition
+        {
+            if (!condition->Meets(sourceInfo))
+                groupMet = false;
+        }
     }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
-            return true;
 
-    return false;
+    return groupMet;
 }
 
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionContainer const& conditions) const
@@ -1079,7 +1083,7 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
 
     QueryResult result = WorldDatabase.PQuery("SELECT SourceTypeOrReferenceId, SourceGroup, SourceEntry, SourceId, ElseGroup, ConditionTypeOrReference, ConditionTarget, "
-                                             " ConditionValue1, ConditionValue2, ConditionValue3, NegativeCondition, ErrorType, ErrorTextId, ScriptName FROM conditions WHERE ((%u >= patch_min) AND (%u <= patch_max))", sWorld->GetWowPatch(), sWorld->GetWowPatch());
+                                             " ConditionValue1, ConditionValue2, ConditionValue3, NegativeCondition, ErrorType, ErrorTextId, ScriptName FROM conditions WHERE ((%u >= patch_min) AND (%u <= patch_max)) ORDER BY ElseGroup", sWorld->GetWowPatch(), sWorld->GetWowPatch());
 
     if (!result)
     {
@@ -1304,9 +1308,38 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
     while (result->NextRow());
 
+    SortStoresByElseGroup();
+
     TC_LOG_INFO("server.loading", ">> Loaded %u conditions in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
 }
 
+void ConditionMgr::SortByElseGroup(ConditionContainer& conditions)
+{
+    std::stable_sort(conditions.begin(), conditions.end(), [](Condition const* a, Condition const* b)
+    {
+        return a->ElseGroup < b->ElseGroup;
+    });
+}
+
+void ConditionMgr::SortStoresByElseGroup()
+{
+    for (ConditionsByEntryMap& conditionsByEntry : ConditionStore)
+        for (auto& itr : conditionsByEntry)
+            SortByElseGroup(itr.second);
+
+    for (auto& itr : ConditionReferenceStore)
+        SortByElseGroup(itr.second);
+
+    for (ConditionEntriesByCreatureIdMap* store : { &VehicleSpellConditionStore, &SpellClickEventConditionStore, &NpcVendorConditionContainerStore })
+        for (auto& conditionsByEntry : *store)
+            for (auto& itr : conditionsByEntry.second)
+                SortByElseGroup(itr.second);
+
+    for (auto& conditionsByEntry : SmartEventConditionStore)
+        for (auto& itr : conditionsByEntry.second)
+            SortByElseGroup(itr.second);
+}
+
 bool ConditionMgr::addToLootTemplate(Condition* cond, LootTemplate* loot) const
 {
     if (!loot)
@@ -1333,6 +1366,7 @@ bool ConditionMgr::addToGossipMenus(Condition* cond) const
             if ((*itr).second.entry == cond->SourceGroup && (*itr).second.text_id == uint32(cond->SourceEntry))
             {
                 (*itr).second.conditions.push_back(cond);
+                SortByElseGroup((*itr).second.conditions);
                 return true;
             }
         }
@@ -1352,6 +1386,7 @@ bool ConditionMgr::addToGossipMenuItems(Condition* cond) const
             if ((*itr).second.MenuId == cond->SourceGroup && (*itr).second.OptionIndex == uint32(cond->SourceEntry))
             {
                 (*itr).second.Conditions.push_back(cond);
+                SortByElseGroup((*itr).second.Conditions);
                 return true;
             }
         }
@@ -1468,7 +1503,10 @@ bool ConditionMgr::addToSpellImplicitTargetConditions(Condition* cond) const
                 }
             }
             if(sharedList)
+            {
                 sharedList->push_back(cond);
+                SortByElseGroup(*sharedList);
+            }
             break;
         }
     }
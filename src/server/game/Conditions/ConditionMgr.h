@@ -8,6 +8,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 class WorldObject;
 class LootTemplate;
@@ -212,12 +213,13 @@ struct Condition
     std::string ToString(bool ext = false) const; /// For logging purpose
 };
 
+// Conditions are sorted by ElseGroup at load (see ConditionMgr::SortByElseGroup), each else group is a contiguous run in the container
 typedef std::vector<Condition*> ConditionContainer;
 typedef std::map<uint32 /*SourceEntry*/, ConditionContainer> ConditionsByEntryMap;
 typedef std::array<ConditionsByEntryMap, CONDITION_SOURCE_TYPE_MAX> ConditionEntriesByTypeArray;
 typedef std::map<uint32, ConditionsByEntryMap> ConditionEntriesByCreatureIdMap;
-typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionsByEntryMap> SmartEventConditionContainer;
-typedef std::map<uint32, ConditionContainer> ConditionReferenceContainer;//only used for references
+typedef std::unordered_map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionsByEntryMap> SmartEventConditionContainer;
+typedef std::unordered_map<uint32, ConditionContainer> ConditionReferenceContainer;//only used for references
 
 class TC_GAME_API ConditionMgr
 {
@@ -250,6 +252,8 @@ class TC_GAME_API ConditionMgr
         bool IsObjectMeetingVehicleSpellConditions(uint32 creatureId, uint32 spellId, Player* player, Unit* vehicle) const;
         bool IsObjectMeetingSmartEventConditions(int32 entryOrGuid, uint32 eventId, uint32 sourceType, Unit* unit, WorldObject* baseObject) const;
         bool IsObjectMeetingVendorItemConditions(uint32 creatureId, uint32 itemId, Player* player, Creature* vendor) const;
+        // Conditions lists are evaluated in a single pass and must keep each else group contiguous
+        static void SortByElseGroup(ConditionContainer& conditions);
 
         struct ConditionTypeInfo
         {
@@ -270,6 +274,7 @@ class TC_GAME_API ConditionMgr
         bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionContainer const& conditions) const;
 
         static void LogUselessConditionValue(Condition* cond, uint8 index, uint32 value);
+        void SortStoresByElseGroup();
 
         void Clean(); // free up resources
         std::vector<Condition*> AllocatedMemoryStore; // some garbage collection :)
@@ -281,6 +281,7 @@ Creature::Creature(bool isWorldObject) : Unit(isWorldObject), MapObject(),
     m_homeless(false), 
     m_respawnCompatibilityMode(false),
     m_triggerJustAppeared(false),
+    m_dormantDiff(0),
     m_boundaryCheckTime(2500), 
     _pickpocketLootRestore(0),
     m_combatPulseTime(0), 
@@ -918,6 +919,50 @@ void Creature::Update(uint32 diff)
     }
 }
 
+bool Creature::SkipDormantUpdate(uint32& diff)
+{
+    uint32 const interval = sWorld->getIntConfig(CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL);
+    if (interval && IsDormant() && m_dormantDiff + diff < interval)
+    {
+        m_dormantDiff += diff;
+        return true;
+    }
+
+    diff += m_dormantDiff;
+    m_dormantDiff = 0;
+    return false;
+}
+
+bool Creature::IsDormant() const
+{
+    if (m_deathState != ALIVE || m_triggerJustAppeared || m_shouldReacquireTarget)
+        return false;
+
+    if (IsInCombat() || IsEngaged() || IsInEvadeMode() || !GetCharmerOrOwnerGUID().IsEmpty())
+        return false;
+
+    if (!m_Events.Empty() || IsNonMeleeSpellCast(true))
+        return false;
+
+    if (!movespline->Finalized() || GetMotionMaster()->GetCurrentMovementGeneratorType() != IDLE_MOTION_TYPE)
+        return false;
+
+    // regeneration is done once per update
+    if (GetHealth() < GetMaxHealth() || GetPower(POWER_MANA) < GetMaxPower(POWER_MANA))
+        return false;
+
+    // timed or periodic auras need their ticks, owned auras include area auras applied to others
+    for (auto const& itr : GetOwnedAuras())
+        if (!itr.second->IsPermanent() || itr.second->IsPeriodic())
+            return false;
+
+    for (auto const& itr : GetAppliedAuras())
+        if (!itr.second->GetBase()->IsPermanent() || itr.second->GetBase()->IsPeriodic())
+            return false;
+
+    return true;
+}
+
 void Creature::Regenerate(Powers power)
 {
     if(m_disabledRegen)
@@ -2121,6 +2166,9 @@ void Creature::SetDeathState(DeathState s)
         Unit::SetDeathState(ALIVE);
         InitCreatureAddon(true);
     }
+
+    if (m_formation)
+        m_formation->MemberDeathStateChanged();
 }
 
 void Creature::SetRespawnTime(uint32 respawn)
@@ -761,6 +761,11 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         std::string const& GetTitle() const { return GetCreatureTemplate()->Title; }
 
         void Update( uint32 time ) override;
+        /* Dormant creatures (see IsDormant) are only updated every CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL ms.
+        Return true if update should be skipped, else diff is increased by the time skipped since last update. */
+        bool SkipDormantUpdate(uint32& diff);
+        // Nothing in the creature update depends on being called every tick
+        bool IsDormant() const;
         void GetRespawnPosition(float &x, float &y, float &z, float* ori = nullptr, float* dist =nullptr) const;
         bool IsSpawnedOnTransport() const;
 
@@ -1198,6 +1203,7 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         CreatureGroup *m_formation;
         bool m_triggerJustAppeared;
         bool m_respawnCompatibilityMode;
+        uint32 m_dormantDiff;                               // time skipped since last update while dormant
 
         CreatureTemplate const* m_creatureInfo;                 // in heroic mode can different from ObjectMgr::GetCreatureTemplate(GetEntry())
         CreatureData const* m_creatureData;
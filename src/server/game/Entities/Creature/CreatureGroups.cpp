@@ -217,6 +217,7 @@ CreatureGroup::CreatureGroup(uint32 id) :
     _formed(false), 
     _engaging(false),
     _justAlive(true),
+    _needsUpdate(true),
     _respawnTimer(RESPAWN_TIMER)
 {}
 
@@ -263,6 +264,7 @@ FormationInfo& CreatureGroup::AddMember(Creature* member)
 
     formationInfo.originalHome = member->GetHomePosition();
     member->SetFormation(this);
+    _needsUpdate = true;
     //std::map::emplace: Returns a pair consisting of an iterator to the inserted element, or the already-existing element if no insertion happened, and a bool denoting whether the insertion took place. True for Insertion, False for No Insertion.
     auto newElementItr = _members.emplace(member, std::move(formationInfo)).first;
     return newElementItr->second;
@@ -279,6 +281,7 @@ void CreatureGroup::RemoveMember(Creature *member)
         //restore original home (for ex: DarkPortalEventDemonAI rely on this)
         member->SetHomePosition(itr->second.originalHome);
         _members.erase(member);
+        _needsUpdate = true;
     }
     member->SetFormation(nullptr);
 }
@@ -452,6 +455,10 @@ void CreatureGroup::Update(uint32 diff)
             _justAlive = false;
         }
     }
+
+    // respawn timer is frozen while the group sleeps, it was going to be reset on next death anyway
+    if (!_justAlive || std::all_of(_members.begin(), _members.end(), [](auto const& i) { return i.first->IsAlive(); }))
+        _needsUpdate = false;
 }
 
 void CreatureGroup::SetLootable(bool lootable)
@@ -75,6 +75,7 @@ class TC_GAME_API CreatureGroup
         bool _formed;
         bool _engaging;
         bool _justAlive; //group was alive at last update
+        bool _needsUpdate; //false while Update has nothing to do: all members alive, or all dead and already made lootable
         uint32 _respawnTimer; //time left before respawning group members with respawn flag (only decreases when out of combat)
     
     public:
@@ -104,7 +105,10 @@ class TC_GAME_API CreatureGroup
         bool CanLeaderStartMoving() const;
 
         void Respawn();
+        // Called by Map for groups needing it only, death state changes of members wake the group up
         void Update(uint32 diff);
+        bool NeedsUpdate() const { return _needsUpdate; }
+        void MemberDeathStateChanged() { _needsUpdate = true; }
         void ForEachMember(std::function<void(Creature*)> const& apply);
         void SetMemberGroupAI(Creature* member, GroupAI ai);
 
@@ -179,92 +179,88 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     ByteBuffer fieldBuffer;
 
     UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
 
     uint32* flags = GameObjectUpdateFieldFlags;
     uint32 visibleFlag = UF_FLAG_PUBLIC;
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    BuildUpdateFieldsMask(updateMask, updateType, flags, visibleFlag, _fieldNotifyFlags);
+    if (forcedFlags)
+        updateMask.SetBit(GAMEOBJECT_FLAGS);
+
+    for (uint32 index = updateMask.FindNextSetBit(0); index < m_valuesCount; index = updateMask.FindNextSetBit(index + 1))
     {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-            (index == GAMEOBJECT_FLAGS && forcedFlags))
+        //LK if (index == GAMEOBJECT_DYNAMIC)
+        if (index == GAMEOBJECT_DYN_FLAGS)
         {
-            updateMask.SetBit(index);
-
-            //LK if (index == GAMEOBJECT_DYNAMIC)
-            if (index == GAMEOBJECT_DYN_FLAGS)
-            {
-                uint16 dynFlags = 0;
+            uint16 dynFlags = 0;
 #ifdef LICH_KING
-               //LK int16 pathProgress = -1;
+           //LK int16 pathProgress = -1;
 #endif
-                switch (GetGoType())
-                {
-                    case GAMEOBJECT_TYPE_QUESTGIVER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_CHEST:
-                    case GAMEOBJECT_TYPE_GOOBER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
-                        else if (targetIsGM)
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_GENERIC:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_SPARKLE;
-                        break;
+            switch (GetGoType())
+            {
+                case GAMEOBJECT_TYPE_QUESTGIVER:
+                    if (ActivateToQuest(target))
+                        dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                    break;
+                case GAMEOBJECT_TYPE_CHEST:
+                case GAMEOBJECT_TYPE_GOOBER:
+                    if (ActivateToQuest(target))
+                        dynFlags |= GO_DYNFLAG_LO_ACTIVATE | GO_DYNFLAG_LO_SPARKLE;
+                    else if (targetIsGM)
+                        dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                    break;
+                case GAMEOBJECT_TYPE_GENERIC:
+                    if (ActivateToQuest(target))
+                        dynFlags |= GO_DYNFLAG_LO_SPARKLE;
+                    break;
 #ifdef LICH_KING
-                    case GAMEOBJECT_TYPE_TRANSPORT:
-                        if (const StaticTransport* t = ToStaticTransport())
-                            if (t->GetPauseTime())
+                case GAMEOBJECT_TYPE_TRANSPORT:
+                    if (const StaticTransport* t = ToStaticTransport())
+                        if (t->GetPauseTime())
+                        {
+                            if (GetGoState() == GO_STATE_READY)
                             {
-                                if (GetGoState() == GO_STATE_READY)
-                                {
-                                    if (t->GetPathProgress() >= t->GetPauseTime()) // if not, send 100% progress
-                                        pathProgress = int16(float(t->GetPathProgress() - t->GetPauseTime()) / float(t->GetPeriod() - t->GetPauseTime()) * 65535.0f);
-                                }
-                                else
-                                {
-                                    if (t->GetPathProgress() <= t->GetPauseTime()) // if not, send 100% progress
-                                        pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPauseTime()) * 65535.0f);
-                                }
+                                if (t->GetPathProgress() >= t->GetPauseTime()) // if not, send 100% progress
+                                    pathProgress = int16(float(t->GetPathProgress() - t->GetPauseTime()) / float(t->GetPeriod() - t->GetPauseTime()) * 65535.0f);
                             }
-                        // else it's ignored
-                        break;
-                    case GAMEOBJECT_TYPE_MO_TRANSPORT:
-                        if (const MotionTransport* t = ToMotionTransport())
-                            pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPeriod()) * 65535.0f);
-                        break;
+                            else
+                            {
+                                if (t->GetPathProgress() <= t->GetPauseTime()) // if not, send 100% progress
+                                    pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPauseTime()) * 65535.0f);
+                            }
+                        }
+                    // else it's ignored
+                    break;
+                case GAMEOBJECT_TYPE_MO_TRANSPORT:
+                    if (const MotionTransport* t = ToMotionTransport())
+                        pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPeriod()) * 65535.0f);
+                    break;
 #endif
-                    default:
-                        break;
-                }
+                default:
+                    break;
+            }
 
 #ifdef LICH_KING
-                fieldBuffer << uint16(dynFlags);
-                fieldBuffer << int16(pathProgress);
+            fieldBuffer << uint16(dynFlags);
+            fieldBuffer << int16(pathProgress);
 #else
-                fieldBuffer << uint32(dynFlags);
+            fieldBuffer << uint32(dynFlags);
 #endif
-            }
-            else if (index == GAMEOBJECT_FLAGS)
-            {
-                uint32 _flags = m_uint32Values[GAMEOBJECT_FLAGS];
-                if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
-                    if (GetGOInfo()->chest.groupLootRules && !IsLootAllowedFor(target))
-                        _flags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
+        }
+        else if (index == GAMEOBJECT_FLAGS)
+        {
+            uint32 _flags = m_uint32Values[GAMEOBJECT_FLAGS];
+            if (GetGoType() == GAMEOBJECT_TYPE_CHEST)
+                if (GetGOInfo()->chest.groupLootRules && !IsLootAllowedFor(target))
+                    _flags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
 
-                fieldBuffer << _flags;
-            }
-            else
-            {
-                fieldBuffer << m_uint32Values[index];                // other cases
-            }
+            fieldBuffer << _flags;
+        }
+        else
+        {
+            fieldBuffer << m_uint32Values[index];                // other cases
         }
     }
 
@@ -273,6 +269,20 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     data->append(fieldBuffer);
 }
 
+bool GameObject::HasViewerDependentValuesUpdate() const
+{
+    // flags are always sent in this case
+    if (GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo()->chest.groupLootRules && HasLootRecipient())
+        return true;
+
+    // fields with a per target value in BuildValuesUpdate
+    for (uint16 index : { GAMEOBJECT_DYN_FLAGS, GAMEOBJECT_FLAGS })
+        if (_changesMask.GetBit(index) || (_fieldNotifyFlags & GameObjectUpdateFieldFlags[index]))
+            return true;
+
+    return false;
+}
+
 void GameObject::AddToWorld()
 {
     if(!IsInWorld())
@@ -518,6 +518,7 @@ class TC_GAME_API GameObject : public WorldObject, public GridObject<GameObject>
         ~GameObject() override;
 
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const override;
+        bool HasViewerDependentValuesUpdate() const override;
 
         void AddToWorld() override;
         void RemoveFromWorld() override;
@@ -212,7 +212,7 @@ void Object::BuildValuesUpdateBlockForPlayer(UpdateData *data, Player *target) c
     data->AddUpdateBlock(buf);
 }
 
-void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) const
+void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map, ValuesUpdateCache* cache /*= nullptr*/) const
 {
     auto iter = data_map.find(player);
     if (iter == data_map.end())
@@ -222,7 +222,26 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map) cons
         iter = p.first;
     }
 
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    if (!cache)
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+        return;
+    }
+
+    uint32* flags = nullptr;
+    uint32 visibleFlag = GetUpdateFieldData(player, flags);
+    auto cached = cache->find(visibleFlag);
+    if (cached == cache->end())
+    {
+        ByteBuffer buf(500);
+        buf << uint8(UPDATETYPE_VALUES);
+        buf << GetPackGUID();
+        BuildValuesUpdate(UPDATETYPE_VALUES, &buf, player);
+
+        cached = cache->emplace(visibleFlag, std::move(buf)).first;
+    }
+
+    iter->second.AddUpdateBlock(cached->second);
 }
 
 uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
@@ -349,27 +368,49 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer * data, Player *targ
 
     ByteBuffer fieldBuffer;
     UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
 
     uint32* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
     ASSERT(flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-    {
-        if (_fieldNotifyFlags & flags[index] ||
-            ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
-    }
+    BuildUpdateFieldsMask(updateMask, updateType, flags, visibleFlag, _fieldNotifyFlags);
+    for (uint32 index = updateMask.FindNextSetBit(0); index < m_valuesCount; index = updateMask.FindNextSetBit(index + 1))
+        fieldBuffer << m_uint32Values[index];
 
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
 }
 
+void Object::BuildUpdateFieldsMask(UpdateMask& updateMask, uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 alwaysFlags) const
+{
+    UpdateFieldFlagsMask const& flagsMask = UpdateFieldFlagsMask::For(flags);
+
+    updateMask.SetCount(m_valuesCount);
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
+    {
+        UpdateMask::ClientUpdateMaskType visible = flagsMask.GetBlock(visibleFlag, block);
+        UpdateMask::ClientUpdateMaskType bits = 0;
+        if (updateType == UPDATETYPE_VALUES)
+            bits = visible & _changesMask.GetBlock(block);
+        else
+        {
+            for (; visible; visible &= visible - 1)
+            {
+                uint32 bit = UpdateMask::CountTrailingZeros(visible);
+                uint32 index = block * UpdateMask::CLIENT_UPDATE_MASK_BITS + bit;
+                if (index < m_valuesCount && m_uint32Values[index])
+                    bits |= UpdateMask::ClientUpdateMaskType(1) << bit;
+            }
+        }
+
+        if (alwaysFlags)
+            bits |= flagsMask.GetBlock(alwaysFlags, block);
+
+        updateMask.SetBlock(block, bits);
+    }
+}
+
 void Object::AddToObjectUpdateIfNeeded()
 {
     if (m_inWorld && !m_objectUpdated)
@@ -2648,7 +2689,11 @@ struct WorldObjectChangeAccumulator
     UpdateDataMapType& i_updateDatas;
     UpdatePlayerSet& i_playerSet;
     WorldObject& i_object;
-    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d, UpdatePlayerSet &p) : i_updateDatas(d), i_object(obj), i_playerSet(p) 
+    // same values block for all players with the same visibility flags, unless some changed fields are written per player
+    ValuesUpdateCache i_valuesCache;
+    bool i_shareValues;
+    WorldObjectChangeAccumulator(WorldObject &obj, UpdateDataMapType &d, UpdatePlayerSet &p) : i_updateDatas(d), i_object(obj), i_playerSet(p),
+        i_shareValues(!obj.HasViewerDependentValuesUpdate())
     { 
         i_playerSet.clear();
     }
@@ -2706,18 +2751,12 @@ struct WorldObjectChangeAccumulator
         }
     }
 
-    /*todo perf: As I understand it, what changes from player to player is visibility, we build almost the same packet for every players here, this could be vastly improved.
-    Maybe we could:
-    - Do a first pass where we just count players in range that should receive the packet
-    - If that count passes a certain threshold (maybe a very low one like 2-3?), send all those players a packet containing all the changes
-    I think that a client ignore "privates" field it shouldn't receive anyway (like those with UF_OWNER) so that shouldn't cause problems
-    */
     void BuildPacket(Player* player)
     {
         // Only send update once to a player
         if (i_playerSet.find(player->GetGUID().GetCounter()) == i_playerSet.end() && player->HaveAtClient(&i_object))
         {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
+            i_object.BuildFieldsUpdate(player, i_updateDatas, i_shareValues ? &i_valuesCache : nullptr);
             i_playerSet.insert(player->GetGUID().GetCounter());
         }
     }
@@ -44,6 +44,8 @@ namespace G3D
 
 typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
 typedef std::unordered_set<uint32> UpdatePlayerSet;
+// Values update blocks built for an object during one BuildUpdate, by visibility flags of the viewers (see GetUpdateFieldData)
+typedef std::unordered_map<uint32 /*visibleFlag*/, ByteBuffer> ValuesUpdateCache;
 
 float const DEFAULT_COLLISION_HEIGHT = 2.03128f; // Most common value in dbc
 
@@ -261,8 +263,11 @@ class TC_GAME_API Object
         /**
            Adds the player and update data for him to the given updateData map. 
            Creates the update map for him if it doesn't exists, else exists the already existing one.
+           If a cache is given, the values update block is only built once for all players with the same visibility flags.
         */
-        void BuildFieldsUpdate(Player*, UpdateDataMapType& data_map) const;
+        void BuildFieldsUpdate(Player*, UpdateDataMapType& data_map, ValuesUpdateCache* cache = nullptr) const;
+        /** True if pending values changes contain fields written differently for each viewer in BuildValuesUpdate, so the block can't be shared between viewers */
+        virtual bool HasViewerDependentValuesUpdate() const { return false; }
 
         /** Force notify of all update fields having this flag. Don't forget to remove it afterwards. */
         void SetFieldNotifyFlag(uint16 flag) { _fieldNotifyFlags |= flag; }
@@ -301,6 +306,10 @@ class TC_GAME_API Object
         void _LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count);
 
         uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+        /** Fields to write in a values update for a target, built 32 fields at a time: changed fields (non zero fields on create)
+            having any of visibleFlag, plus all fields having any of alwaysFlags.
+        */
+        void BuildUpdateFieldsMask(UpdateMask& updateMask, uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 alwaysFlags) const;
 
         void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
         /**
@@ -58,12 +58,13 @@ class UpdateData
 
         GuidSet const& GetOutOfRangeGUIDs() const { return m_outOfRangeGUIDs; }
 
+        // dst_size is set to 0 on failure
+        static void Compress(void* dst, uint32 *dst_size, void* src, int src_size);
+
     protected:
         uint32 m_blockCount;  //one per object updated
         GuidSet m_outOfRangeGUIDs;
         ByteBuffer m_data;
-
-        void Compress(void* dst, uint32 *dst_size, void* src, int src_size);
 };
 #endif
 
@@ -2146,3 +2146,35 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+UpdateFieldFlagsMask::UpdateFieldFlagsMask(uint32 const* flags, uint32 count)
+{
+    for (uint32 bit = 0; bit < UF_FLAG_BITS; ++bit)
+    {
+        _fieldsByFlag[bit].SetCount(count);
+        for (uint32 index = 0; index < count; ++index)
+            if (flags[index] & (1 << bit))
+                _fieldsByFlag[bit].SetBit(index);
+    }
+}
+
+UpdateFieldFlagsMask const& UpdateFieldFlagsMask::For(uint32 const* flags)
+{
+    static UpdateFieldFlagsMask const itemMask(ItemUpdateFieldFlags, CONTAINER_END);
+    static UpdateFieldFlagsMask const unitMask(UnitUpdateFieldFlags, PLAYER_END);
+    static UpdateFieldFlagsMask const gameObjectMask(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+    static UpdateFieldFlagsMask const dynamicObjectMask(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+    static UpdateFieldFlagsMask const corpseMask(CorpseUpdateFieldFlags, CORPSE_END);
+
+    if (flags == UnitUpdateFieldFlags)
+        return unitMask;
+    if (flags == GameObjectUpdateFieldFlags)
+        return gameObjectMask;
+    if (flags == ItemUpdateFieldFlags)
+        return itemMask;
+    if (flags == DynamicObjectUpdateFieldFlags)
+        return dynamicObjectMask;
+
+    ASSERT(flags == CorpseUpdateFieldFlags);
+    return corpseMask;
+}
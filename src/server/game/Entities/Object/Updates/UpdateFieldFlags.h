@@ -2,6 +2,7 @@
 #define _UPDATEFIELDFLAGS_H
 
 #include "UpdateFields.h"
+#include "UpdateMask.h"
 #include "Define.h"
 
 enum UpdatefieldFlags
@@ -18,10 +19,36 @@ enum UpdatefieldFlags
     UF_FLAG_DYNAMIC      = 0x100
 };
 
+#define UF_FLAG_BITS 9
+
 extern uint32 ItemUpdateFieldFlags[CONTAINER_END];
 extern uint32 UnitUpdateFieldFlags[PLAYER_END];
 extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+/* Fields of one of the tables above, by flag. Lets visibility be checked 32 fields at a time
+against an UpdateMask instead of testing the flags of each field. */
+class TC_GAME_API UpdateFieldFlagsMask
+{
+    public:
+        UpdateFieldFlagsMask(uint32 const* flags, uint32 count);
+
+        // Block of the fields having any of the given flags
+        UpdateMask::ClientUpdateMaskType GetBlock(uint32 anyOfFlags, uint32 block) const
+        {
+            UpdateMask::ClientUpdateMaskType bits = 0;
+            for (uint32 flag = anyOfFlags & ((1 << UF_FLAG_BITS) - 1); flag; flag &= flag - 1)
+                bits |= _fieldsByFlag[UpdateMask::CountTrailingZeros(flag)].GetBlock(block);
+
+            return bits;
+        }
+
+        // Mask for one of the tables above
+        static UpdateFieldFlagsMask const& For(uint32 const* flags);
+
+    private:
+        UpdateMask _fieldsByFlag[UF_FLAG_BITS];
+};
+
 #endif // _UPDATEFIELDFLAGS_H
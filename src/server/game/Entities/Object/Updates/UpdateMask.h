@@ -2,6 +2,11 @@
 #define __UPDATEMASK_H
 
 #include "ByteBuffer.h"
+#include "CompilerDefs.h"
+
+#if COMPILER == TRINITY_COMPILER_MICROSOFT
+#include <intrin.h>
+#endif
 
 class UpdateMask
 {
@@ -14,30 +19,69 @@ class UpdateMask
             CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
         };
 
-        UpdateMask() : _fieldCount(0), _blockCount(0), _bits(nullptr) { }
+        UpdateMask() : _fieldCount(0), _blockCount(0), _blocks(nullptr) { }
 
-        UpdateMask(UpdateMask const& right) : _bits(nullptr)
+        UpdateMask(UpdateMask const& right) : _blocks(nullptr)
         {
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+            memcpy(_blocks, right._blocks, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
-        ~UpdateMask() { delete[] _bits; }
+        ~UpdateMask() { delete[] _blocks; }
 
-        void SetBit(uint32 index, bool set = true) { _bits[index] = uint8(set); }
-        bool GetBit(uint32 index) const { return _bits[index] != 0; }
+        void SetBit(uint32 index, bool set = true)
+        {
+            if (set)
+                _blocks[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS);
+            else
+                _blocks[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS));
+        }
+        bool GetBit(uint32 index) const { return (_blocks[index / CLIENT_UPDATE_MASK_BITS] >> (index % CLIENT_UPDATE_MASK_BITS)) & 1; }
 
-        void AppendToPacket(ByteBuffer* data)
+        /// Blocks are the 32 fields words sent to client. Bits past the field count are dropped when setting the last block.
+        ClientUpdateMaskType GetBlock(uint32 block) const { return _blocks[block]; }
+        void SetBlock(uint32 block, ClientUpdateMaskType bits)
         {
-            for (uint32 i = 0; i < GetBlockCount(); ++i)
+            if (block == _blockCount - 1 && _fieldCount % CLIENT_UPDATE_MASK_BITS)
+                bits &= (ClientUpdateMaskType(1) << (_fieldCount % CLIENT_UPDATE_MASK_BITS)) - 1;
+
+            _blocks[block] = bits;
+        }
+
+        /** Index of the first set bit at or after given index, or GetCount() if none. Use to visit set bits only:
+            for (uint32 index = mask.FindNextSetBit(0); index < mask.GetCount(); index = mask.FindNextSetBit(index + 1))
+        */
+        uint32 FindNextSetBit(uint32 index) const
+        {
+            uint32 block = index / CLIENT_UPDATE_MASK_BITS;
+            if (block >= _blockCount)
+                return _fieldCount;
+
+            ClientUpdateMaskType bits = _blocks[block] & (~ClientUpdateMaskType(0) << (index % CLIENT_UPDATE_MASK_BITS));
+            while (!bits)
             {
-                ClientUpdateMaskType maskPart = 0;
-                for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                    if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                        maskPart |= 1 << j;
+                if (++block >= _blockCount)
+                    return _fieldCount;
 
-                *data << maskPart;
+                bits = _blocks[block];
             }
+
+            return block * CLIENT_UPDATE_MASK_BITS + CountTrailingZeros(bits);
+        }
+
+        bool IsEmpty() const
+        {
+            for (uint32 i = 0; i < _blockCount; ++i)
+                if (_blocks[i])
+                    return false;
+
+            return true;
+        }
+
+        void AppendToPacket(ByteBuffer* data)
+        {
+            for (uint32 i = 0; i < GetBlockCount(); ++i)
+                *data << _blocks[i];
         }
 
         uint32 GetBlockCount() const { return _blockCount; }
@@ -45,19 +89,19 @@ class UpdateMask
 
         void SetCount(uint32 valuesCount)
         {
-            delete[] _bits;
+            delete[] _blocks;
 
             _fieldCount = valuesCount;
             _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
 
-            _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-            memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            _blocks = new ClientUpdateMaskType[_blockCount];
+            memset(_blocks, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         void Clear()
         {
-            if (_bits)
-                memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            if (_blocks)
+                memset(_blocks, 0, sizeof(ClientUpdateMaskType) * _blockCount);
         }
 
         UpdateMask& operator=(UpdateMask const& right)
@@ -66,15 +110,15 @@ class UpdateMask
                 return *this;
 
             SetCount(right.GetCount());
-            memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+            memcpy(_blocks, right._blocks, sizeof(ClientUpdateMaskType) * _blockCount);
             return *this;
         }
 
         UpdateMask& operator&=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
-                _bits[i] &= right._bits[i];
+            for (uint32 i = 0; i < right._blockCount; ++i)
+                _blocks[i] &= right._blocks[i];
 
             return *this;
         }
@@ -82,8 +126,8 @@ class UpdateMask
         UpdateMask& operator|=(UpdateMask const& right)
         {
             ASSERT(right.GetCount() <= GetCount());
-            for (uint32 i = 0; i < _fieldCount; ++i)
-                _bits[i] |= right._bits[i];
+            for (uint32 i = 0; i < right._blockCount; ++i)
+                _blocks[i] |= right._blocks[i];
 
             return *this;
         }
@@ -95,14 +139,25 @@ class UpdateMask
             return ret;
         }
 
+        /// bits must not be 0
+        static uint32 CountTrailingZeros(ClientUpdateMaskType bits)
+        {
+#if COMPILER == TRINITY_COMPILER_MICROSOFT
+            unsigned long index;
+            _BitScanForward(&index, bits);
+            return uint32(index);
+#else
+            return uint32(__builtin_ctz(bits));
+#endif
+        }
+
     private:
         /** Total update field count for object, updated or not */
         uint32 _fieldCount;
         /** Or 'how much uint32 blocks do we need to fit one bit per field' */
-        uint32 _blockCount; 
-        /* Complete update mask, one bit per field */
-        uint8* _bits;
+        uint32 _blockCount;
+        /* Complete update mask, one bit per field, packed in client blocks */
+        ClientUpdateMaskType* _blocks;
 };
 
 #endif
-
@@ -497,7 +497,7 @@ void Pet::SavePetToDB(PetSaveMode mode)
 
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
     _SaveSpells(trans);
-    GetSpellHistory()->SaveToDB<Pet>(trans);
+    GetSpellHistory()->SaveToDB<Pet>(trans, true);
     if(getPetType() == HUNTER_PET)
         _SaveAuras(trans);
 
@@ -73,6 +73,8 @@
 #include "PoolMgr.h"
 #include "WorldStatePackets.h"
 #include "TicketMgr.h"
+#include "Monitor.h"
+#include "PlayerSaveQueue.h"
 
 #ifdef PLAYERBOT
 #include "PlayerbotAI.h"
@@ -208,6 +210,8 @@ Player::Player(WorldSession *session) :
         SetAcceptWhispers(true);
 
     m_nextSave = sWorld->getConfig(CONFIG_INTERVAL_SAVE);
+    m_saveDirtyFlags = PLAYER_SAVE_DIRTY_NONE;
+    m_savesSinceFullSave = 0;
 
     clearResurrectRequestData();
 
@@ -218,6 +222,7 @@ Player::Player(WorldSession *session) :
     // group is initialized in the reference constructor
     SetGroupInvite(nullptr);
     m_groupUpdateMask = 0;
+    m_timeSinceGroupUpdate = 0;
     m_auraUpdateMask = 0;
 
     m_ControlledByPlayer = true;
@@ -1393,9 +1398,9 @@ void Player::Update( uint32 p_time )
     {
         if(p_time >= m_nextSave)
         {
-            // m_nextSave reseted in SaveToDB call
-            SaveToDB();
-            TC_LOG_DEBUG("entities.player","Player '%s' (GUID: %u) saved", GetName().c_str(), GetGUID().GetCounter());
+            // saved from world thread at a controlled rate, m_nextSave is reset again in SaveToDB call
+            m_nextSave = sWorld->getConfig(CONFIG_INTERVAL_SAVE);
+            sPlayerSaveQueue->Enqueue(GetGUID());
         }
         else
         {
@@ -1440,7 +1445,7 @@ void Player::Update( uint32 p_time )
     UpdateHomebindTime(p_time);
 
     // group update
-    SendUpdateToOutOfRangeGroupMembers();
+    SendUpdateToOutOfRangeGroupMembers(p_time);
 
     Pet* pet = GetPet();
     if(pet && !IsWithinDistInMap(pet, OWNER_MAX_DISTANCE) && !pet->IsPossessed())
@@ -15364,6 +15369,7 @@ bool Player::LoadFromDB( uint32 guid, SQLQueryHolder *holder )
 
             // We are not in BG anymore
             m_bgData.bgInstanceID = 0;
+            SetSaveDirty(PLAYER_SAVE_DIRTY_BG_DATA);
         }
     }
 
@@ -15611,9 +15617,9 @@ bool Player::LoadFromDB( uint32 guid, SQLQueryHolder *holder )
     SaveRecallPosition();
 
 
-    // randomize first save time in range [CONFIG_INTERVAL_SAVE] around [CONFIG_INTERVAL_SAVE]
+    // spread first save time in range [CONFIG_INTERVAL_SAVE] around [CONFIG_INTERVAL_SAVE]
     // this must help in case next save after mass player load after server startup
-    m_nextSave = urand(m_nextSave / 2, m_nextSave * 3 / 2);
+    m_nextSave = sPlayerSaveQueue->GetFirstSaveDelay();
 
     time_t now = map->GetGameTime();
     time_t logoutTime = time_t(fields[LOAD_DATA_LOGOUT_TIME].GetUInt32());
@@ -17149,6 +17155,8 @@ void Player::SaveToDB(bool create /*=false*/)
 {
     // delay auto save at any saves (manual, in code, or autosave)
     m_nextSave = sWorld->getConfig(CONFIG_INTERVAL_SAVE);
+    if (!create)
+        sPlayerSaveQueue->Remove(GetGUID());
 
     //lets allow only players in world to be saved
     if (IsBeingTeleportedFar())
@@ -17163,6 +17171,19 @@ void Player::SaveToDB(bool create /*=false*/)
     if (!create)
         sScriptMgr->OnPlayerSave(this); 
 
+    // Subsystems without their own state tracking are only saved when changed, except on full saves.
+    // Full saves happen at creation, logout and every PlayerSave.FullSaveEvery saves, to also catch up on values we don't track (such as aura durations)
+    bool fullSave = create || !IsInWorld() || GetSession()->PlayerLogout();
+    if (uint32 fullSaveEvery = sWorld->getConfig(CONFIG_PLAYER_SAVE_FULL_EVERY))
+        if (++m_savesSinceFullSave >= fullSaveEvery)
+            fullSave = true;
+
+    if (fullSave)
+    {
+        m_saveDirtyFlags = PLAYER_SAVE_DIRTY_ALL;
+        m_savesSinceFullSave = 0;
+    }
+
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
     PreparedStatement* stmt = nullptr;
     uint8 index = 0;
@@ -17430,7 +17451,8 @@ void Player::SaveToDB(bool create /*=false*/)
     if(m_mailsUpdated)                                     //save mails only when needed
         _SaveMail(trans);
     
-    _SaveBGData(trans);
+    if (m_saveDirtyFlags & PLAYER_SAVE_DIRTY_BG_DATA)
+        _SaveBGData(trans);
     _SaveInventory(trans);
     _SaveQuestStatus(trans);
     _SaveDailyQuestStatus(trans);
@@ -17440,13 +17462,17 @@ void Player::SaveToDB(bool create /*=false*/)
 #endif
     _SaveSeasonalQuestStatus(trans);
     _SaveSpells(trans);
-    GetSpellHistory()->SaveToDB<Player>(trans);
+    GetSpellHistory()->SaveToDB<Player>(trans, fullSave);
     _SaveActions(trans);
-    _SaveAuras(trans);
+    if (m_saveDirtyFlags & PLAYER_SAVE_DIRTY_AURAS)
+        _SaveAuras(trans);
     _SaveSkills(trans);
     m_reputationMgr->SaveToDB(trans);
     GetSession()->SaveTutorialsData(trans);                 // changed only while character in game
 
+    m_saveDirtyFlags = PLAYER_SAVE_DIRTY_NONE;
+    sMonitor->PlayerSaved(trans->GetSize(), fullSave);
+
     WorldSession* session = GetSession(); //This player object won't exist anymore when executing the callback, so extract session in a variable to capture
     GetSession()->GetQueryProcessor().AddQuery(CharacterDatabase.CommitTransaction(trans).WithCallback([session, create]() -> void
     {
@@ -17652,6 +17678,7 @@ void Player::_SaveInventory(SQLTransaction trans)
         return;
     }
 
+    // inventory rows first and item instances after, so that rows of the same statement follow each other and get batched
     for(auto item : m_itemUpdateQueue)
     {
         if(!item) continue;
@@ -17662,10 +17689,14 @@ void Player::_SaveInventory(SQLTransaction trans)
         switch(item->GetState())
         {
             case ITEM_NEW:
-                trans->PAppend("INSERT INTO character_inventory (guid,bag,slot,item,item_template) VALUES ('%u', '%u', '%u', '%u', '%u')", GetGUID().GetCounter(), bag_guid, item->GetSlot(), item->GetGUID().GetCounter(), item->GetEntry());
-                break;
             case ITEM_CHANGED:
-                trans->PAppend("UPDATE character_inventory SET guid='%u', bag='%u', slot='%u', item_template='%u' WHERE item='%u'", GetGUID().GetCounter(), bag_guid, item->GetSlot(), item->GetEntry(), item->GetGUID().GetCounter());
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_INVENTORY_ITEM);
+                stmt->setUInt32(0, GetGUID().GetCounter());
+                stmt->setUInt32(1, bag_guid);
+                stmt->setUInt8(2, item->GetSlot());
+                stmt->setUInt32(3, item->GetGUID().GetCounter());
+                stmt->setUInt32(4, item->GetEntry());
+                trans->Append(stmt);
                 break;
             case ITEM_REMOVED:
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_INVENTORY_BY_ITEM);
@@ -17675,9 +17706,12 @@ void Player::_SaveInventory(SQLTransaction trans)
             case ITEM_UNCHANGED:
                 break;
         }
-
-        item->SaveToDB(trans);                                   // item have unchanged inventory record and can be save standalone
     }
+
+    for(auto item : m_itemUpdateQueue)
+        if(item)
+            item->SaveToDB(trans);                               // item have unchanged inventory record and can be save standalone
+
     m_itemUpdateQueue.clear();
 }
 
@@ -17766,6 +17800,8 @@ void Player::_SaveQuestStatus(SQLTransaction& trans)
 
     bool keepAbandoned = true; //TC!(sWorld->GetCleaningFlags() & CharacterDatabaseCleaner::CLEANING_FLAG_QUESTSTATUS);
 
+    // deletions are appended after the replaces, so those get batched
+    std::vector<uint32> deletedQuests;
     for (saveItr = m_QuestStatusSave.begin(); saveItr != m_QuestStatusSave.end(); ++saveItr)
     {
         if (saveItr->second == QUEST_DEFAULT_SAVE_TYPE)
@@ -17793,12 +17829,15 @@ void Player::_SaveQuestStatus(SQLTransaction& trans)
             }
         }
         else
-        {
-            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST);
-            stmt->setUInt32(0, GetGUID().GetCounter());
-            stmt->setUInt32(1, saveItr->first);
-            trans->Append(stmt);
-        }
+            deletedQuests.push_back(saveItr->first);
+    }
+
+    for (uint32 questId : deletedQuests)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_QUESTSTATUS_BY_QUEST);
+        stmt->setUInt32(0, GetGUID().GetCounter());
+        stmt->setUInt32(1, questId);
+        trans->Append(stmt);
     }
 
     m_QuestStatusSave.clear();
@@ -17943,15 +17982,34 @@ void Player::_SaveSkills(SQLTransaction trans)
 
 void Player::_SaveSpells(SQLTransaction trans)
 {
+    PreparedStatement* stmt;
+
+    // all deletions first, so the inserts below follow each other and get batched
+    for (PlayerSpellMap::const_iterator itr = m_spells.begin(); itr != m_spells.end(); ++itr)
+    {
+        if (itr->second->state == PLAYERSPELL_REMOVED || itr->second->state == PLAYERSPELL_CHANGED)
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_BY_SPELL);
+            stmt->setUInt32(0, itr->first);
+            stmt->setUInt32(1, GetGUID().GetCounter());
+            trans->Append(stmt);
+        }
+    }
+
     for (PlayerSpellMap::const_iterator itr = m_spells.begin(), next = m_spells.begin(); itr != m_spells.end(); itr = next)
     {
         ++next;
-        if (itr->second->state == PLAYERSPELL_REMOVED || itr->second->state == PLAYERSPELL_CHANGED)
-            trans->PAppend("DELETE FROM character_spell WHERE guid = '%u' and spell = '%u'", GetGUID().GetCounter(), itr->first);
 
         // add only changed/new not dependent spells
         if ((!itr->second->dependent && itr->second->state == PLAYERSPELL_NEW) || itr->second->state == PLAYERSPELL_CHANGED)
-            trans->PAppend("INSERT INTO character_spell (guid,spell,active,disabled) VALUES ('%u','%u','%u','%u')", GetGUID().GetCounter(), itr->first, uint32(itr->second->active), uint32(itr->second->disabled));
+        {
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SPELL);
+            stmt->setUInt32(0, GetGUID().GetCounter());
+            stmt->setUInt32(1, itr->first);
+            stmt->setBool(2, itr->second->active);
+            stmt->setBool(3, itr->second->disabled);
+            trans->Append(stmt);
+        }
 
         if (itr->second->state == PLAYERSPELL_REMOVED)
             _removeSpell(itr->first);
@@ -19896,6 +19954,8 @@ void Player::SetBattlegroundEntryPoint()
 
     if (m_bgData.joinPos.m_mapId == MAPID_INVALID) // In error cases use homebind position
         m_bgData.joinPos = WorldLocation(m_homebindMapId, m_homebindX, m_homebindY, m_homebindZ, 0.0f);
+
+    SetSaveDirty(PLAYER_SAVE_DIRTY_BG_DATA);
 }
 
 bool Player::TeleportToBGEntryPoint()
@@ -20487,10 +20547,18 @@ bool Player::ValidateAppearance(uint8 race, uint8 class_, uint8 gender, uint8 ha
     return true;
 }
 
-void Player::SendUpdateToOutOfRangeGroupMembers()
+void Player::SendUpdateToOutOfRangeGroupMembers(uint32 diff)
 {
+    m_timeSinceGroupUpdate = std::min<uint32>(m_timeSinceGroupUpdate + diff, HOUR * IN_MILLISECONDS);
+
     if (m_groupUpdateMask == GROUP_UPDATE_FLAG_NONE)
         return;
+
+    uint32 const interval = sWorld->getIntConfig(m_groupUpdateMask == GROUP_UPDATE_FLAG_POSITION ? CONFIG_GROUP_MEMBER_POSITION_INTERVAL : CONFIG_GROUP_MEMBER_STATS_INTERVAL);
+    if (m_timeSinceGroupUpdate < interval)
+        return;
+
+    m_timeSinceGroupUpdate = 0;
     if(Group* group = GetGroup())
         group->UpdatePlayerOutOfRange(this);
 
@@ -21388,6 +21456,7 @@ void Player::SetBattlegroundId(uint32 val, BattlegroundTypeId bgTypeId)
 {
     m_bgData.bgInstanceID = val;
     m_bgData.bgTypeID = bgTypeId;
+    SetSaveDirty(PLAYER_SAVE_DIRTY_BG_DATA);
 }
 
 uint32 Player::AddBattlegroundQueueId(BattlegroundQueueTypeId val)
@@ -23229,6 +23298,7 @@ void Player::ProcessDelayedOperations()
         {
             CastSpell(this, m_bgData.mountSpell, true);
             m_bgData.mountSpell = 0;
+            SetSaveDirty(PLAYER_SAVE_DIRTY_BG_DATA);
         }
     }
 
@@ -23239,6 +23309,7 @@ void Player::ProcessDelayedOperations()
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[0]);
             m_taxi.AddTaxiDestination(m_bgData.taxiPath[1]);
             m_bgData.ClearTaxiPath();
+            SetSaveDirty(PLAYER_SAVE_DIRTY_BG_DATA);
 
             ContinueTaxiFlight();
         }
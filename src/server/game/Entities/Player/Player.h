@@ -1004,6 +1004,16 @@ enum PlayerDelayedOperations
     DELAYED_END
 };
 
+// Save subsystems without per row state tracking, only written when flagged or on full saves (see PlayerSave.FullSaveEvery)
+enum PlayerSaveDirtyFlags
+{
+    PLAYER_SAVE_DIRTY_NONE      = 0x00,
+    PLAYER_SAVE_DIRTY_AURAS     = 0x01,
+    PLAYER_SAVE_DIRTY_BG_DATA   = 0x02,
+
+    PLAYER_SAVE_DIRTY_ALL       = PLAYER_SAVE_DIRTY_AURAS | PLAYER_SAVE_DIRTY_BG_DATA
+};
+
 // Player summoning auto-decline time (in secs)
 #define MAX_PLAYER_SUMMON_DELAY                   (2*MINUTE)
 // Maximum money amount : 2^31 - 1
@@ -1587,6 +1597,8 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         bool m_mailsLoaded;
         bool m_mailsUpdated;
 
+        void SetSaveDirty(PlayerSaveDirtyFlags flags) { m_saveDirtyFlags |= flags; }
+
         void SetBindPoint(ObjectGuid guid);
         void SendTalentWipeConfirm(ObjectGuid guid);
         void RewardRage( uint32 damage, uint32 weaponSpeedHitFactor, bool attacker );
@@ -1816,7 +1828,8 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         void UninviteFromGroup();
         static void RemoveFromGroup(Group* group, ObjectGuid guid, RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT, ObjectGuid kicker = ObjectGuid::Empty, char const* reason = nullptr);
         void RemoveFromGroup(RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT) { RemoveFromGroup(GetGroup(), GetGUID(), method); }
-        void SendUpdateToOutOfRangeGroupMembers();
+        // Changes are merged and sent at most every CONFIG_GROUP_MEMBER_STATS_INTERVAL, or CONFIG_GROUP_MEMBER_POSITION_INTERVAL for position only
+        void SendUpdateToOutOfRangeGroupMembers(uint32 diff);
 
         void SetInGuild(uint32 guildId);
         void SetRank(uint32 rankId);
@@ -2564,6 +2577,8 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         uint8 m_gender;
         uint32 m_team;
         uint32 m_nextSave;
+        uint32 m_saveDirtyFlags;
+        uint32 m_savesSinceFullSave;
         time_t m_speakTime;
         uint32 m_speakCount;
         Difficulty m_dungeonDifficulty;
@@ -2671,6 +2686,7 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
         GroupReference m_originalGroup;
         Group *m_groupInvite;
         uint32 m_groupUpdateMask;
+        uint32 m_timeSinceGroupUpdate;
         uint64 m_auraUpdateMask;
 
         // Temporarily removed pet cache
@@ -0,0 +1,80 @@
+#include "PlayerSaveQueue.h"
+#include "DatabaseEnv.h"
+#include "Monitor.h"
+#include "ObjectAccessor.h"
+#include "Player.h"
+#include "World.h"
+#include <cmath>
+
+PlayerSaveQueue::PlayerSaveQueue() : _loginCount(0)
+{
+}
+
+void PlayerSaveQueue::Enqueue(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!_queued.insert(guid).second)
+    {
+        ++sMonitor->_playerSaves.coalesced;
+        return;
+    }
+
+    _queue.push_back(guid);
+    ++sMonitor->_playerSaves.queued;
+}
+
+void PlayerSaveQueue::Remove(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _queued.erase(guid);
+}
+
+void PlayerSaveQueue::Update()
+{
+    uint32 maxSaves = sWorld->getConfig(CONFIG_PLAYER_SAVE_QUEUE_MAX_PER_UPDATE);
+    uint32 backpressure = sWorld->getConfig(CONFIG_PLAYER_SAVE_QUEUE_BACKPRESSURE);
+    if (backpressure && CharacterDatabase.QueueSize() > backpressure)
+    {
+        maxSaves = 1;
+        ++sMonitor->_playerSaves.throttledUpdates;
+    }
+
+    for (uint32 saves = 0; saves < maxSaves;)
+    {
+        ObjectGuid guid;
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (_queue.empty())
+                return;
+
+            guid = _queue.front();
+            _queue.pop_front();
+            if (!_queued.erase(guid))
+                continue; // already saved since queued
+        }
+
+        // logged out players have been saved at logout
+        if (Player* player = ObjectAccessor::FindPlayer(guid))
+        {
+            player->SaveToDB();
+            TC_LOG_DEBUG("entities.player", "Player '%s' (GUID: %u) saved", player->GetName().c_str(), guid.GetCounter());
+            ++saves;
+        }
+    }
+}
+
+uint32 PlayerSaveQueue::GetFirstSaveDelay()
+{
+    // golden ratio low discrepancy sequence, any run of successive logins is spread evenly over [0, 1[
+    double const goldenRatioConjugate = 0.6180339887498949;
+    double fraction = std::fmod(_loginCount++ * goldenRatioConjugate, 1.0);
+
+    uint32 interval = sWorld->getConfig(CONFIG_INTERVAL_SAVE);
+    return interval / 2 + uint32(fraction * interval);
+}
+
+size_t PlayerSaveQueue::GetSize()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _queued.size();
+}
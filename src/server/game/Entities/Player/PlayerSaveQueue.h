@@ -0,0 +1,50 @@
+#ifndef __TRINITY_PLAYERSAVEQUEUE_H
+#define __TRINITY_PLAYERSAVEQUEUE_H
+
+#include "ObjectGuid.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_set>
+
+/* Player autosaves are not executed from Player::Update anymore but queued here, then executed from the
+world thread at a limited rate per world update. Queuing a player already waiting coalesces both requests,
+and any other save of the player cancels its pending autosave.
+When the async character database queue grows over PlayerSave.Queue.Backpressure, only one save per update
+is done until it drains back. */
+class TC_GAME_API PlayerSaveQueue
+{
+    private:
+        PlayerSaveQueue();
+        ~PlayerSaveQueue() = default;
+
+    public:
+        static PlayerSaveQueue* instance()
+        {
+            static PlayerSaveQueue instance;
+            return &instance;
+        }
+
+        // Can be called from map threads
+        void Enqueue(ObjectGuid guid);
+        void Remove(ObjectGuid guid);
+
+        // World thread only, outside of map updates
+        void Update();
+
+        // Delay before the first autosave of a player logging in, in [interval/2, interval*3/2[.
+        // Successive logins are spread evenly over that range so that mass logins after startup don't save at the same time.
+        uint32 GetFirstSaveDelay();
+
+        size_t GetSize();
+
+    private:
+        std::mutex _lock;
+        std::deque<ObjectGuid> _queue;          // may contain removed guids, skipped when popped
+        std::unordered_set<ObjectGuid> _queued;
+        std::atomic<uint32> _loginCount;
+};
+
+#define sPlayerSaveQueue PlayerSaveQueue::instance()
+
+#endif
@@ -80,6 +80,9 @@ bool PlayerSocial::AddToSocialList(ObjectGuid::LowType friend_guid, bool _ignore
         fi.Flags |= flag;
         m_playerSocialMap[friend_guid] = fi;
     }
+
+    if (_ignore)
+        UpdateIgnoreList();
     return true;
 }
 
@@ -103,6 +106,17 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid::LowType friend_guid, bool _i
     {
         CharacterDatabase.PExecute("UPDATE character_social SET flags = (flags & ~%u) WHERE guid = '%u' AND friend = '%u'", flag, GetPlayerGUID(), friend_guid);
     }
+
+    if (_ignore)
+        UpdateIgnoreList();
+}
+
+void PlayerSocial::UpdateIgnoreList()
+{
+    m_ignoreList.clear();
+    for (auto const& itr : m_playerSocialMap)       // map is sorted by guid
+        if (itr.second.Flags & SOCIAL_FLAG_IGNORED)
+            m_ignoreList.push_back(itr.first);
 }
 
 void PlayerSocial::SetFriendNote(ObjectGuid::LowType friend_guid, std::string note)
@@ -162,10 +176,7 @@ bool PlayerSocial::HasFriend(ObjectGuid::LowType friend_guid)
 
 bool PlayerSocial::HasIgnore(ObjectGuid::LowType ignore_guid)
 {
-    auto itr = m_playerSocialMap.find(ignore_guid);
-    if(itr != m_playerSocialMap.end())
-        return itr->second.Flags & SOCIAL_FLAG_IGNORED;
-    return false;
+    return !m_ignoreList.empty() && std::binary_search(m_ignoreList.begin(), m_ignoreList.end(), ignore_guid);
 }
 
 SocialMgr::SocialMgr()
@@ -330,6 +341,7 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid::LowT
     }
     while( result->NextRow() );
 
+    social->UpdateIgnoreList();
     return social;
 }
 
@@ -110,7 +110,10 @@ class TC_GAME_API PlayerSocial
         void SetPlayerGUID(ObjectGuid::LowType guid) { m_playerGUID = guid; }
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag);
     private:
+        void UpdateIgnoreList();
+
         PlayerSocialMap m_playerSocialMap;
+        std::vector<ObjectGuid::LowType> m_ignoreList;          // sorted ignored guids, HasIgnore is called for every channel message member
         ObjectGuid::LowType m_playerGUID;
 };
 
@@ -3231,7 +3231,6 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     ByteBuffer fieldBuffer;
 
     UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
 
     uint32* flags = UnitUpdateFieldFlags;
     uint32 visibleFlag = UF_FLAG_PUBLIC;
@@ -3250,186 +3249,185 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     if (plr && plr->IsInSameRaidWith(target))
         visibleFlag |= UF_FLAG_PARTY_MEMBER;
 
+    // changed (or non zero on create) fields visible to player
+    // + fields set to notify
+    // + UF_FLAG_SPECIAL_INFO fields if target has SPELL_AURA_EMPATHY on the target
+    BuildUpdateFieldsMask(updateMask, updateType, flags, visibleFlag, _fieldNotifyFlags | (visibleFlag & UF_FLAG_SPECIAL_INFO));
+    // we always send update while the object has some per caster aura state
+    if (HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK))
+        updateMask.SetBit(UNIT_FIELD_AURASTATE);
+
     Creature const* creature = ToCreature();
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 index = updateMask.FindNextSetBit(0); index < m_valuesCount; index = updateMask.FindNextSetBit(index + 1))
     {
-        if (   _fieldNotifyFlags & flags[index]  //if the given flag was set to notify, if the given index is not set to UF_FLAG_NONE
-            || ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) //given index has UF_FLAG_SPECIAL_INFO and target has SPELL_AURA_EMPATHY on the target
-            || ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) // flag has changed && flag is visible to player
-            || (index == UNIT_FIELD_AURASTATE && HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK)) //if index UNIT_FIELD_AURASTATE && unit has some state (we always send update while the object has those)
-           )
+        switch (index)
+        {
+        case UNIT_FIELD_HEALTH:
         {
-            updateMask.SetBit(index);
+            //for creatures, send 0 health. This prevents health from showing in the bottom right tooltip when mouse hovering over the creature
+            if (GetTypeId() == TYPEID_UNIT && m_uint32Values[UNIT_DYNAMIC_FLAGS] & UNIT_DYNFLAG_DEAD)
+                fieldBuffer << uint32(0);
+            else
+                fieldBuffer << m_uint32Values[index];
 
-            switch (index)
-            {
-            case UNIT_FIELD_HEALTH:
-            {
-                //for creatures, send 0 health. This prevents health from showing in the bottom right tooltip when mouse hovering over the creature
-                if (GetTypeId() == TYPEID_UNIT && m_uint32Values[UNIT_DYNAMIC_FLAGS] & UNIT_DYNFLAG_DEAD)
-                    fieldBuffer << uint32(0);
-                else
-                    fieldBuffer << m_uint32Values[index];
+        } break;
+        case UNIT_NPC_FLAGS:
+        {
+            uint32 appendValue = m_uint32Values[UNIT_NPC_FLAGS];
 
-            } break;
-            case UNIT_NPC_FLAGS:
+            if (creature)
             {
-                uint32 appendValue = m_uint32Values[UNIT_NPC_FLAGS];
-
-                if (creature)
-                {
 #ifdef LICH_KING
-                    if (!target->CanSeeSpellClickOn(creature))
-                        appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
+                if (!target->CanSeeSpellClickOn(creature))
+                    appendValue &= ~UNIT_NPC_FLAG_SPELLCLICK;
 #endif
-                    if (appendValue & UNIT_NPC_FLAG_FLIGHTMASTER)
-                    {
-                        //sun: give quest marker precedence over flight master icon
-                        QuestGiverStatus questStatus = target->GetQuestDialogStatus(const_cast<Creature*>(creature));
-                        if (questStatus == DIALOG_STATUS_REWARD
-                            || questStatus == DIALOG_STATUS_AVAILABLE
-                            || questStatus == DIALOG_STATUS_REWARD) //any status missing?
-                            appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
-                    }
-                }
-
-                fieldBuffer << uint32(appendValue);
-            } break;
-            case UNIT_FIELD_AURASTATE:
-            {
-                // Check per caster aura states to not enable using a spell in client if specified aura is not by target
-                fieldBuffer << BuildAuraStateUpdateForTarget(target);
-            } break;
-            // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-            case UNIT_FIELD_BASEATTACKTIME:
-            case UNIT_FIELD_BASEATTACKTIME+1:
-            case UNIT_FIELD_RANGEDATTACKTIME:
-            {
-                // convert from float to uint32 and send
-                fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
-            } break;
-            // there are some float values which may be negative or can't get negative due to other checks
-            case UNIT_FIELD_NEGSTAT0:
-            case UNIT_FIELD_NEGSTAT1:
-            case UNIT_FIELD_NEGSTAT2:
-            case UNIT_FIELD_NEGSTAT3:
-            case UNIT_FIELD_NEGSTAT4:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 1:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 2:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 3:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 4:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 5:
-            case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 1:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 2:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 3:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 4:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 5:
-            case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6:
-            case UNIT_FIELD_POSSTAT0:
-            case UNIT_FIELD_POSSTAT1:
-            case UNIT_FIELD_POSSTAT2:
-            case UNIT_FIELD_POSSTAT3:
-            case UNIT_FIELD_POSSTAT4:
-            {
-                fieldBuffer << uint32(m_floatValues[index]);
-            } break;
-            // Gamemasters should be always able to select units - remove not selectable flag
-            case UNIT_FIELD_FLAGS:;
-            {
-                uint32 appendValue = m_uint32Values[UNIT_FIELD_FLAGS];
-                if (target->IsGameMaster())
-                    appendValue &= ~UNIT_FLAG_NOT_SELECTABLE;
-
-                fieldBuffer << uint32(appendValue);
-            } break;
-            // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
-            case UNIT_FIELD_DISPLAYID:
-            {
-                uint32 displayId = m_uint32Values[UNIT_FIELD_DISPLAYID];
-                if (creature)
+                if (appendValue & UNIT_NPC_FLAG_FLIGHTMASTER)
                 {
-                    CreatureTemplate const* cinfo = creature->GetCreatureTemplate();
-
-                    // this also applies for transform auras
-                    if (SpellInfo const* transform = sSpellMgr->GetSpellInfo(GetTransformSpell()))
-                        for (const auto & Effect : transform->Effects)
-                            if (Effect.ApplyAuraName == SPELL_AURA_TRANSFORM)
-                                if (CreatureTemplate const* transformInfo = sObjectMgr->GetCreatureTemplate(Effect.MiscValue))
-                                {
-                                    cinfo = transformInfo;
-                                    break;
-                                }
-
-                    if (cinfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER)
-                        if (target->IsGameMaster())
-                            displayId = cinfo->GetFirstVisibleModel();
+                    //sun: give quest marker precedence over flight master icon
+                    QuestGiverStatus questStatus = target->GetQuestDialogStatus(const_cast<Creature*>(creature));
+                    if (questStatus == DIALOG_STATUS_REWARD
+                        || questStatus == DIALOG_STATUS_AVAILABLE
+                        || questStatus == DIALOG_STATUS_REWARD) //any status missing?
+                        appendValue &= ~UNIT_NPC_FLAG_FLIGHTMASTER;
                 }
+            }
+
+            fieldBuffer << uint32(appendValue);
+        } break;
+        case UNIT_FIELD_AURASTATE:
+        {
+            // Check per caster aura states to not enable using a spell in client if specified aura is not by target
+            fieldBuffer << BuildAuraStateUpdateForTarget(target);
+        } break;
+        // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+        case UNIT_FIELD_BASEATTACKTIME:
+        case UNIT_FIELD_BASEATTACKTIME+1:
+        case UNIT_FIELD_RANGEDATTACKTIME:
+        {
+            // convert from float to uint32 and send
+            fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+        } break;
+        // there are some float values which may be negative or can't get negative due to other checks
+        case UNIT_FIELD_NEGSTAT0:
+        case UNIT_FIELD_NEGSTAT1:
+        case UNIT_FIELD_NEGSTAT2:
+        case UNIT_FIELD_NEGSTAT3:
+        case UNIT_FIELD_NEGSTAT4:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 1:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 2:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 3:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 4:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 5:
+        case UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 1:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 2:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 3:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 4:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 5:
+        case UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6:
+        case UNIT_FIELD_POSSTAT0:
+        case UNIT_FIELD_POSSTAT1:
+        case UNIT_FIELD_POSSTAT2:
+        case UNIT_FIELD_POSSTAT3:
+        case UNIT_FIELD_POSSTAT4:
+        {
+            fieldBuffer << uint32(m_floatValues[index]);
+        } break;
+        // Gamemasters should be always able to select units - remove not selectable flag
+        case UNIT_FIELD_FLAGS:;
+        {
+            uint32 appendValue = m_uint32Values[UNIT_FIELD_FLAGS];
+            if (target->IsGameMaster())
+                appendValue &= ~UNIT_FLAG_NOT_SELECTABLE;
 
-                fieldBuffer << uint32(displayId);
-            } break;
-            // hide lootable animation for unallowed players
-            case UNIT_DYNAMIC_FLAGS:
+            fieldBuffer << uint32(appendValue);
+        } break;
+        // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
+        case UNIT_FIELD_DISPLAYID:
+        {
+            uint32 displayId = m_uint32Values[UNIT_FIELD_DISPLAYID];
+            if (creature)
             {
-                uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+                CreatureTemplate const* cinfo = creature->GetCreatureTemplate();
 
-                if (creature)
-                {
-                    if (creature->hasLootRecipient())
-                    {
-                        dynamicFlags |= UNIT_DYNFLAG_TAPPED;
-                        if (creature->isTappedBy(target))
-                            dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
-                    }
+                // this also applies for transform auras
+                if (SpellInfo const* transform = sSpellMgr->GetSpellInfo(GetTransformSpell()))
+                    for (const auto & Effect : transform->Effects)
+                        if (Effect.ApplyAuraName == SPELL_AURA_TRANSFORM)
+                            if (CreatureTemplate const* transformInfo = sObjectMgr->GetCreatureTemplate(Effect.MiscValue))
+                            {
+                                cinfo = transformInfo;
+                                break;
+                            }
 
-                    if (!target->IsAllowedToLoot(creature))
-                        dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
+                if (cinfo->flags_extra & CREATURE_FLAG_EXTRA_TRIGGER)
+                    if (target->IsGameMaster())
+                        displayId = cinfo->GetFirstVisibleModel();
+            }
+
+            fieldBuffer << uint32(displayId);
+        } break;
+        // hide lootable animation for unallowed players
+        case UNIT_DYNAMIC_FLAGS:
+        {
+            uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+
+            if (creature)
+            {
+                if (creature->hasLootRecipient())
+                {
+                    dynamicFlags |= UNIT_DYNFLAG_TAPPED;
+                    if (creature->isTappedBy(target))
+                        dynamicFlags |= UNIT_DYNFLAG_TAPPED_BY_PLAYER;
                 }
 
-                // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
-                if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
-                    if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
-                        dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+                if (!target->IsAllowedToLoot(creature))
+                    dynamicFlags &= ~UNIT_DYNFLAG_LOOTABLE;
+            }
 
-                fieldBuffer << dynamicFlags;
-            } break;
-            // FG: pretend that OTHER players in own group are friendly ("blue")
+            // unit UNIT_DYNFLAG_TRACK_UNIT should only be sent to caster of SPELL_AURA_MOD_STALKED auras
+            if (dynamicFlags & UNIT_DYNFLAG_TRACK_UNIT)
+                if (!HasAuraTypeWithCaster(SPELL_AURA_MOD_STALKED, target->GetGUID()))
+                    dynamicFlags &= ~UNIT_DYNFLAG_TRACK_UNIT;
+
+            fieldBuffer << dynamicFlags;
+        } break;
+        // FG: pretend that OTHER players in own group are friendly ("blue")
 #ifdef LICH_KING
-            case UNIT_FIELD_BYTES_2: //UNIT_FIELD_BYTES_2 is not used for factions or pvp in BC
+        case UNIT_FIELD_BYTES_2: //UNIT_FIELD_BYTES_2 is not used for factions or pvp in BC
 #endif
-            case UNIT_FIELD_FACTIONTEMPLATE:
+        case UNIT_FIELD_FACTIONTEMPLATE:
+        {
+            if (IsControlledByPlayer() && target != this && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP) && IsInRaidWith(target))
             {
-                if (IsControlledByPlayer() && target != this && sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GROUP) && IsInRaidWith(target))
+                FactionTemplateEntry const* ft1 = GetFactionTemplateEntry();
+                FactionTemplateEntry const* ft2 = target->GetFactionTemplateEntry();
+                if (ft1 && ft2 && !ft1->IsFriendlyTo(*ft2))
                 {
-                    FactionTemplateEntry const* ft1 = GetFactionTemplateEntry();
-                    FactionTemplateEntry const* ft2 = target->GetFactionTemplateEntry();
-                    if (ft1 && ft2 && !ft1->IsFriendlyTo(*ft2))
-                    {
 #ifdef LICH_KING
-                        if (index == UNIT_FIELD_BYTES_2)
-                            // Allow targetting opposite faction in party when enabled in config
-                            fieldBuffer << (m_uint32Values[UNIT_FIELD_BYTES_2] & ((UNIT_BYTE2_FLAG_UNK3) << 8)); // this flag is at uint8 offset 1 !!
-                        else
-#endif
-                            // pretend that all other HOSTILE players have own faction, to allow follow, heal, rezz (trade wont work)
-                            fieldBuffer << uint32(target->GetFaction());
-                    }
+                    if (index == UNIT_FIELD_BYTES_2)
+                        // Allow targetting opposite faction in party when enabled in config
+                        fieldBuffer << (m_uint32Values[UNIT_FIELD_BYTES_2] & ((UNIT_BYTE2_FLAG_UNK3) << 8)); // this flag is at uint8 offset 1 !!
                     else
-                        fieldBuffer << m_uint32Values[index];
+#endif
+                        // pretend that all other HOSTILE players have own faction, to allow follow, heal, rezz (trade wont work)
+                        fieldBuffer << uint32(target->GetFaction());
                 }
                 else
                     fieldBuffer << m_uint32Values[index];
-            } break;
-            default:
-            {
-                // send in current format (float as float, uint32 as uint32)
-                fieldBuffer << m_uint32Values[index];
-            } break;
             }
-            
+            else
+                fieldBuffer << m_uint32Values[index];
+        } break;
+        default:
+        {
+            // send in current format (float as float, uint32 as uint32)
+            fieldBuffer << m_uint32Values[index];
+        } break;
         }
+        
     }
 
     *data << uint8(updateMask.GetBlockCount());
@@ -3437,6 +3435,28 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
     data->append(fieldBuffer);
 }
 
+bool Unit::HasViewerDependentValuesUpdate() const
+{
+    // fields with a per target value in BuildValuesUpdate
+    static uint16 const viewerDependentFields[] =
+    {
+        UNIT_NPC_FLAGS, UNIT_FIELD_AURASTATE, UNIT_FIELD_FLAGS, UNIT_FIELD_DISPLAYID, UNIT_DYNAMIC_FLAGS, UNIT_FIELD_FACTIONTEMPLATE,
+#ifdef LICH_KING
+        UNIT_FIELD_BYTES_2,
+#endif
+    };
+
+    // always sent while set
+    if (HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK))
+        return true;
+
+    for (uint16 index : viewerDependentFields)
+        if (_changesMask.GetBit(index) || (_fieldNotifyFlags & UnitUpdateFieldFlags[index]))
+            return true;
+
+    return false;
+}
+
 int32 Unit::GetHighestExclusiveSameEffectSpellGroupValue(AuraEffect const* aurEff, AuraType auraType, bool checkMiscValue /*= false*/, int32 miscValue /*= 0*/) const
 {
     int32 val = 0;
@@ -12726,6 +12746,7 @@ void Unit::_AddAura(UnitAura* aura, Unit* caster)
 {
     ASSERT(!m_cleanupDone);
     m_ownedAuras.emplace(aura->GetId(), aura);
+    aura->SetNeedSaveForOwner();
 
     _RemoveNoStackAurasDueToAura(aura);
 
@@ -13033,6 +13054,7 @@ void Unit::RemoveOwnedAura(AuraMap::iterator& i, AuraRemoveMode removeMode)
 
     m_ownedAuras.erase(i);
     m_removedAuras.push_back(aura);
+    aura->SetNeedSaveForOwner();
 
     // Unregister single target aura
     if (aura->IsSingleTarget())
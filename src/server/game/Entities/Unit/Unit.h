@@ -1957,6 +1957,7 @@ class TC_GAME_API Unit : public WorldObject
         explicit Unit (bool isWorldObject);
 
         void BuildValuesUpdate(uint8 updatetype, ByteBuffer* data, Player* target) const override;
+        bool HasViewerDependentValuesUpdate() const override;
 
         bool _last_in_water_status;
         Position _lastInWaterCheckPosition;
@@ -21,6 +21,7 @@
 #include "MapInstanced.h"
 #include "World.h"
 #include "Transport.h"
+#include <array>
 #include <cmath>
 #include <boost/thread/shared_mutex.hpp>
 #include <boost/thread/locks.hpp>
@@ -73,19 +74,64 @@ HashMapHolder<Player>::MapType const& ObjectAccessor::GetPlayers()
 template class TC_GAME_API HashMapHolder<Player>;
 template class TC_GAME_API HashMapHolder<MotionTransport>;
 
-namespace PlayerNameMapHolder
+/* Player lookups by guid or name are done from every map thread (chat, group, guild, mail handlers...).
+They go through these indexes, split in shards each with their own lock, so that a lookup only contends with
+lookups and logins hashed to the same shard instead of serializing on the HashMapHolder<Player> lock.
+HashMapHolder<Player> is still used for iteration over all players. */
+template<typename Key>
+class PlayerLookupIndex
 {
-    typedef std::unordered_map<std::string, Player*> MapType;
-    static MapType PlayerNameMap;
+public:
+    static uint32 const SHARD_COUNT = 16;
 
+    void Insert(Key const& key, Player* p)
+    {
+        Shard& shard = GetShard(key);
+        boost::unique_lock<boost::shared_mutex> lock(shard.lock);
+        shard.players[key] = p;
+    }
+
+    void Remove(Key const& key)
+    {
+        Shard& shard = GetShard(key);
+        boost::unique_lock<boost::shared_mutex> lock(shard.lock);
+        shard.players.erase(key);
+    }
+
+    Player* Find(Key const& key)
+    {
+        Shard& shard = GetShard(key);
+        boost::shared_lock<boost::shared_mutex> lock(shard.lock);
+        auto itr = shard.players.find(key);
+        return (itr != shard.players.end()) ? itr->second : nullptr;
+    }
+
+private:
+    // one cache line per shard, so that locks of different shards don't share one
+    struct alignas(64) Shard
+    {
+        boost::shared_mutex lock;
+        std::unordered_map<Key, Player*> players;
+    };
+
+    Shard& GetShard(Key const& key) { return _shards[std::hash<Key>()(key) % SHARD_COUNT]; }
+
+    std::array<Shard, SHARD_COUNT> _shards;
+};
+
+static PlayerLookupIndex<ObjectGuid> PlayerGuidIndex;
+static PlayerLookupIndex<std::string> PlayerNameIndex;
+
+namespace PlayerNameMapHolder
+{
     void Insert(Player* p)
     {
-        PlayerNameMap[p->GetName()] = p;
+        PlayerNameIndex.Insert(p->GetName(), p);
     }
 
     void Remove(Player* p)
     {
-        PlayerNameMap.erase(p->GetName());
+        PlayerNameIndex.Remove(p->GetName());
     }
 
     Player* Find(std::string const& name)
@@ -94,8 +140,7 @@ namespace PlayerNameMapHolder
         if (!normalizePlayerName(charName))
             return nullptr;
 
-        auto itr = PlayerNameMap.find(charName);
-        return (itr != PlayerNameMap.end()) ? itr->second : nullptr;
+        return PlayerNameIndex.Find(charName);
     }
 } // namespace PlayerNameMapHolder
 
@@ -199,7 +244,7 @@ Pet* ObjectAccessor::GetPet(WorldObject const& u, ObjectGuid const& guid)
 
 Player* ObjectAccessor::GetPlayer(Map const* m, ObjectGuid const& guid)
 {
-    if (Player* player = HashMapHolder<Player>::Find(guid))
+    if (Player* player = PlayerGuidIndex.Find(guid))
         if (player->IsInWorld() && player->GetMap() == m)
             return player;
 
@@ -224,7 +269,7 @@ Creature* ObjectAccessor::GetCreatureOrPetOrVehicle(WorldObject const& u, Object
 
 Player* ObjectAccessor::FindPlayer(ObjectGuid const& guid)
 {
-    Player* player = HashMapHolder<Player>::Find(guid);
+    Player* player = PlayerGuidIndex.Find(guid);
     return player && player->IsInWorld() ? player : nullptr;
 }
 
@@ -245,7 +290,7 @@ Player* ObjectAccessor::FindPlayerByLowGUID(ObjectGuid::LowType lowguid)
 
 Player* ObjectAccessor::FindConnectedPlayer(ObjectGuid const& guid)
 {
-    return HashMapHolder<Player>::Find(guid);
+    return PlayerGuidIndex.Find(guid);
 }
 
 Player* ObjectAccessor::FindConnectedPlayerByName(std::string const& name)
@@ -266,6 +311,7 @@ template<>
 void ObjectAccessor::AddObject(Player* player)
 {
     HashMapHolder<Player>::Insert(player);
+    PlayerGuidIndex.Insert(player->GetGUID(), player);
     PlayerNameMapHolder::Insert(player);
 }
 
@@ -273,5 +319,6 @@ template<>
 void ObjectAccessor::RemoveObject(Player* player)
 {
     HashMapHolder<Player>::Remove(player);
+    PlayerGuidIndex.Remove(player->GetGUID());
     PlayerNameMapHolder::Remove(player);
 }
@@ -106,10 +106,12 @@ namespace Trinity
 		float i_distSq;
 		Team team;
 		Player const* skipped_receiver;
-		MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = NULL)
+		std::vector<Player*>* i_receivers; // if set, receivers are collected instead of sending them the message
+		MessageDistDeliverer(WorldObject const* src, WorldPacket const* msg, float dist, bool own_team_only = false, Player const* skipped = NULL, std::vector<Player*>* receivers = nullptr)
 			: i_source(src), i_message(msg), i_phaseMask(src->GetPhaseMask()), i_distSq(dist * dist)
 			, team(Team(0))
 			, skipped_receiver(skipped)
+			, i_receivers(receivers)
 		{
 			if (own_team_only)
 				if (Player const* player = src->ToPlayer())
@@ -129,7 +131,10 @@ namespace Trinity
 			if (!player->HaveAtClient(i_source))
 				return;
 
-			player->GetSession()->SendPacket(i_message);
+			if (i_receivers)
+				i_receivers->push_back(player);
+			else
+				player->GetSession()->SendPacket(i_message);
 		}
 	};
 
@@ -32,8 +32,17 @@ inline void
 Trinity::ObjectUpdater::Visit(CreatureMapType &m)
 {
     for(auto & iter : m)
-        if(iter.GetSource()->IsInWorld())
-            iter.GetSource()->Update(i_timeDiff);
+    {
+        Creature* creature = iter.GetSource();
+        if (!creature->IsInWorld())
+            continue;
+
+        uint32 diff = i_timeDiff;
+        if (creature->SkipDormantUpdate(diff))
+            continue;
+
+        creature->Update(diff);
+    }
 }
 
 template<class T>
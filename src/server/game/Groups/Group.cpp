@@ -1813,26 +1813,22 @@ void Group::Update(time_t diff)
 
 void Group::UpdatePlayerOutOfRange(Player* player)
 {
-    if (!player || !player->IsInWorld())
+    if (!player || !player->IsInWorld() || player->GetGroupUpdateFlag() == GROUP_UPDATE_FLAG_NONE)
         return;
 
-    //sunstrider: Only build packet if needed
-    std::list<Player const*> sendTo;
-    Player const* member;
+    //sunstrider: Only build packet if needed, then share it with all members
+    WorldPacket data;
     for (GroupReference *itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
-        member = itr->GetSource();
+        Player const* member = itr->GetSource();
         if (member && member != player && (!member->IsInMap(player) || !member->IsWithinDist(player, member->GetSightRange(), false))) //use HaveAtClient instead?
-            sendTo.push_back(member);
-    }
-
-    if (sendTo.empty())
-        return;
+        {
+            if (data.GetOpcode() == NULL_OPCODE)
+                player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &data);
 
-    WorldPacket data;
-    player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &data);
-    for (auto itr : sendTo)
-        itr->SendDirectMessage(&data);
+            member->SendDirectMessage(&data);
+        }
+    }
 }
 
 void Group::BroadcastPacket(WorldPacket *packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignoredPlayer)
@@ -5,10 +5,11 @@
 #include "World.h"
 #include "ObjectMgr.h"
 #include "AccountMgr.h"
+#include <algorithm>
 
 #define NO_SESSION_STRING "no session"
 
-LogsDatabaseAccessor::LogsDatabaseAccessor() : max_trade_id(0)
+LogsDatabaseAccessor::LogsDatabaseAccessor() : max_trade_id(0), _flushTimer(0)
 {
     PreparedStatement* stmt = LogsDatabase.GetPreparedStatement(LOGS_SEL_CHAR_TRADE_MAX_ID);
     if (PreparedQueryResult result = LogsDatabase.Query(stmt))
@@ -20,6 +21,55 @@ LogsDatabaseAccessor::LogsDatabaseAccessor() : max_trade_id(0)
     }
 }
 
+void LogsDatabaseAccessor::Execute(PreparedStatement* stmt)
+{
+    if (!sWorld->getConfig(CONFIG_LOGS_BATCH_INTERVAL))
+    {
+        LogsDatabase.Execute(stmt);
+        return;
+    }
+
+    sLogsDatabaseAccessor->_pendingStatements.Enqueue(stmt);
+}
+
+void LogsDatabaseAccessor::Update(uint32 diff)
+{
+    _flushTimer += diff;
+    if (_flushTimer < sWorld->getConfig(CONFIG_LOGS_BATCH_INTERVAL))
+        return;
+
+    _flushTimer = 0;
+    Flush();
+}
+
+void LogsDatabaseAccessor::Flush()
+{
+    std::vector<PreparedStatement*> statements;
+    PreparedStatement* stmt;
+    while (_pendingStatements.Dequeue(stmt))
+        statements.push_back(stmt);
+
+    if (statements.empty())
+        return;
+
+    // consecutive inserts of the same statement are merged into multi-row inserts when executing the transaction
+    std::stable_sort(statements.begin(), statements.end(), [](PreparedStatement const* a, PreparedStatement const* b)
+    {
+        return a->GetIndex() < b->GetIndex();
+    });
+
+    // one transaction per statement, so that a failing row only rolls back the logs of the same kind
+    for (auto runStart = statements.begin(); runStart != statements.end();)
+    {
+        uint32 const index = (*runStart)->GetIndex();
+        SQLTransaction trans = LogsDatabase.BeginTransaction();
+        for (; runStart != statements.end() && (*runStart)->GetIndex() == index; ++runStart)
+            trans->Append(*runStart);
+
+        LogsDatabase.CommitTransaction(trans);
+    }
+}
+
 bool LogsDatabaseAccessor::ShouldLog(WorldConfigs configIndex, WorldConfigs configIndexGM, bool gmInvolved)
 {
     uint32 duration = sWorld->getConfig(configIndex);
@@ -46,7 +96,7 @@ void LogsDatabaseAccessor::Enchantment(Player const* caster, Player const* targe
     stmt->setString(6, caster->GetSession()->GetRemoteAddress());
     stmt->setString(7, targetPlayer->GetSession()->GetRemoteAddress());
     stmt->setBool(8, gmInvolved);
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::BattlegroundStats(uint32 mapId, time_t start, time_t end, Team winner, uint32 scoreAlliance, uint32 scoreHorde)
@@ -75,7 +125,7 @@ void LogsDatabaseAccessor::BattlegroundStats(uint32 mapId, time_t start, time_t
     stmt->setUInt32(5, scoreHorde);
     //+ also log brackets? GetUniqueBracketId()
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::BossDown(Creature const* victim, std::string const& bossName, std::string const& bossNameFr, uint32 downByGuildId, std::string const& guildName, uint32 guildPercentage, uint32 leaderGuid)
@@ -94,7 +144,7 @@ void LogsDatabaseAccessor::BossDown(Creature const* victim, std::string const& b
     stmt->setUInt32(5, guildPercentage);
     stmt->setUInt32(6, leaderGuid);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::CharacterDelete(WorldSession const* session, ObjectGuid::LowType playerGUID, std::string const& charName, uint8 /* level */, std::string const& IP)
@@ -113,7 +163,7 @@ void LogsDatabaseAccessor::CharacterDelete(WorldSession const* session, ObjectGu
     stmt->setString(3, IP);
     stmt->setBool(4, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::CharacterRename(WorldSession const* session, ObjectGuid::LowType playerGUID, std::string const& oldName, std::string const& newName, std::string const& IP)
@@ -131,7 +181,7 @@ void LogsDatabaseAccessor::CharacterRename(WorldSession const* session, ObjectGu
     stmt->setString(3, newName);
     stmt->setString(4, IP);
     stmt->setBool(5, gmInvolved);
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::GMCommand(WorldSession const* m_session, Unit const* target, std::string const& fullcmd)
@@ -202,7 +252,7 @@ void LogsDatabaseAccessor::GMCommand(WorldSession const* m_session, Unit const*
     stmt->setFloat(15, (player && player->GetSelectedUnit()) ? player->GetSelectedUnit()->GetPositionZ() : 0);
     stmt->setString(16, fullcmd);
     stmt->setString(17, m_session ? m_session->GetRemoteAddress() : NO_SESSION_STRING);
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::CharacterChat(ChatMsg type, Language lang, Player const* player, Player const* toPlayer, uint32 logChannelId, std::string const& to, std::string const& msg)
@@ -232,7 +282,7 @@ void LogsDatabaseAccessor::CharacterChat(ChatMsg type, Language lang, Player con
     stmt->setString(7, session->GetRemoteAddress());
     stmt->setBool(  8, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 
@@ -254,7 +304,7 @@ void LogsDatabaseAccessor::GuildMoneyTransfer(Player const* player, uint32 guild
     stmt->setString(4, player->GetSession()->GetRemoteAddress());
     stmt->setBool(5, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 
@@ -278,7 +328,7 @@ void LogsDatabaseAccessor::GuildBankItemTransfer(Player const* player, bool depo
     stmt->setString(7, player->GetSession()->GetRemoteAddress());
     stmt->setBool(8, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::CharacterItemDelete(Player const* player, Item const* item)
@@ -298,7 +348,7 @@ void LogsDatabaseAccessor::CharacterItemDelete(Player const* player, Item const*
     stmt->setString(4, player->GetSession()->GetRemoteAddress());
     stmt->setBool(5, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::Sanction(WorldSession const* authorSession, uint32 targetAccount, ObjectGuid::LowType targetGUID, SanctionType type, uint32 durationSecs, std::string const& reason)
@@ -326,7 +376,7 @@ void LogsDatabaseAccessor::Sanction(WorldSession const* authorSession, uint32 ta
     stmt->setString(7, reason);
     stmt->setString(8, authorSession ? authorSession->GetRemoteAddress() : NO_SESSION_STRING);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::RemoveSanction(WorldSession const* authorSession, uint32 targetAccount, ObjectGuid::LowType targetGUID, std::string const& targetIP, SanctionType type)
@@ -345,7 +395,7 @@ void LogsDatabaseAccessor::RemoveSanction(WorldSession const* authorSession, uin
     stmt->setUInt8(5, uint8(type));
     stmt->setString(6, authorSession ? authorSession->GetRemoteAddress() : NO_SESSION_STRING);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::Mail(uint32 mailId, MailMessageType type, uint32 sender_guidlow_or_entry, uint32 receiver_guidlow, std::string const subject, std::string const body, MailDraft::MailItemMap const& items, uint32 money, uint32 cod)
@@ -497,7 +547,7 @@ void LogsDatabaseAccessor::WonAuction(uint32 bidderAccount, ObjectGuid::LowType
     stmt->setUInt16(6, itemCount);
     stmt->setBool(7, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::CreateAuction(Player const* player, ObjectGuid::LowType itemGUID, uint32 itemEntry, uint32 itemCount)
@@ -521,7 +571,7 @@ void LogsDatabaseAccessor::CreateAuction(Player const* player, ObjectGuid::LowTy
     stmt->setString(5, session->GetRemoteAddress());
     stmt->setBool(6, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::BuyOrSellItemToVendor(BuyTransactionType type, Player const* player, Item const* item, Unit const* vendor)
@@ -555,7 +605,7 @@ void LogsDatabaseAccessor::BuyOrSellItemToVendor(BuyTransactionType type, Player
     stmt->setString(6, player->GetSession()->GetRemoteAddress());
     stmt->setBool(7, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
 
 void LogsDatabaseAccessor::CleanupOldLogs()
@@ -633,5 +683,5 @@ void LogsDatabaseAccessor::LogConnectionIP(WorldSession const* session)
     stmt->setString(1, session->GetRemoteAddress());
     stmt->setBool(2, gmInvolved);
 
-    LogsDatabase.Execute(stmt);
+    Execute(stmt);
 }
\ No newline at end of file
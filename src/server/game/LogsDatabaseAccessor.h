@@ -4,9 +4,11 @@
 #include "Define.h"
 #include "SharedDefines.h"
 #include "Mail.h"
+#include "MPSCQueue.h"
 
 class Creature;
 class Player;
+class PreparedStatement;
 enum MailMessageType : uint32;
 class WorldSession;
 class Item;
@@ -25,6 +27,11 @@ public:
 
     LogsDatabaseAccessor();
 
+    // World thread. Executes statements logged since last batch, every LogsDatabase.BatchInterval
+    void Update(uint32 diff);
+    // Executes all pending statements now
+    void Flush();
+
     // Cleanup mon_* table according to config CONFIG_MONITORING_KEEP_DURATION
     static void CleanupOldMonitorLogs();
     // Cleanup most log tables according to their respective CONFIG_LOG_* options
@@ -63,8 +70,13 @@ public:
     void CharacterTrade(Player const* p1, Player const* p2, std::vector<Item*> const& p1Items, std::vector<Item*> const& p2Items, uint32 p1Gold, uint32 p2Gold);
 private:
     static bool ShouldLog(WorldConfigs configIndex, WorldConfigs configIndexGM, bool gmInvolved);
+    // Queues statement for next batch, can be called from map threads
+    static void Execute(PreparedStatement* stmt);
 
     uint32 max_trade_id;
+
+    MPSCQueue<PreparedStatement> _pendingStatements;
+    uint32 _flushTimer;
 };
 
 #define sLogsDatabaseAccessor LogsDatabaseAccessor::instance()
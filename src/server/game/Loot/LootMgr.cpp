@@ -364,31 +364,46 @@ void LootTemplate::LootGroup::AddEntry(LootStoreItem* item)
 }
 
 // Rolls an item from the group, returns NULL if all miss their chances
+// Entries invalid for this loot are skipped in place instead of filtering copies of the lists
 LootStoreItem const* LootTemplate::LootGroup::Roll(Loot& loot, uint16 lootMode) const
 {
-    LootStoreItemList possibleLoot = ExplicitlyChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
+    LootGroupInvalidSelector isInvalid(loot, lootMode);
 
-    if (!possibleLoot.empty())                             // First explicitly chanced entries are checked
+    // First explicitly chanced entries are checked
+    bool rolled = false;
+    float roll = 0.0f;
+    for (LootStoreItem* item : ExplicitlyChanced)   // check each explicitly chanced entry in the template and modify its chance based on quality.
     {
-        float roll = (float)rand_chance();
+        if (isInvalid(item))
+            continue;
 
-        for (LootStoreItemList::const_iterator itr = possibleLoot.begin(); itr != possibleLoot.end(); ++itr)   // check each explicitly chanced entry in the template and modify its chance based on quality.
+        if (!rolled)
         {
-            LootStoreItem* item = *itr;
-            if (item->chance >= 100.0f)
-                return item;
-
-            roll -= item->chance;
-            if (roll < 0)
-                return item;
+            roll = (float)rand_chance();
+            rolled = true;
         }
+
+        if (item->chance >= 100.0f)
+            return item;
+
+        roll -= item->chance;
+        if (roll < 0)
+            return item;
     }
 
-    possibleLoot = EqualChanced;
-    possibleLoot.remove_if(LootGroupInvalidSelector(loot, lootMode));
-    if (!possibleLoot.empty())                              // If nothing selected yet - an item is taken from equal-chanced part
-        return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
+    // If nothing selected yet - an item is taken from equal-chanced part
+    uint32 possibleCount = 0;
+    for (LootStoreItem* item : EqualChanced)
+        if (!isInvalid(item))
+            ++possibleCount;
+
+    if (possibleCount)
+    {
+        uint32 index = urand(0, possibleCount - 1);
+        for (LootStoreItem* item : EqualChanced)
+            if (!isInvalid(item) && !index--)
+                return item;
+    }
 
     return nullptr;                                            // Empty drop from the group
 }
@@ -704,6 +719,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
             if (Entrie->itemid == uint32(cond->SourceEntry))
             {
                 Entrie->conditions.push_back(cond);
+                ConditionMgr::SortByElseGroup(Entrie->conditions);
                 return true;
             }
         }
@@ -724,6 +740,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                     if (i->itemid == uint32(cond->SourceEntry))
                     {
                         i->conditions.push_back(cond);
+                        ConditionMgr::SortByElseGroup(i->conditions);
                         return true;
                     }
                 }
@@ -737,6 +754,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                     if (i->itemid == uint32(cond->SourceEntry))
                     {
                         i->conditions.push_back(cond);
+                        ConditionMgr::SortByElseGroup(i->conditions);
                         return true;
                     }
                 }
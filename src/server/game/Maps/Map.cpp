@@ -38,6 +38,9 @@
 #include "ScriptMgr.h"
 #include "GameTime.h"
 #include "PathGenerator.h"
+#include "UpdateData.h"
+#include "zlib.h"
+#include "Profiler.h"
 #ifdef TESTS
 #include "TestCase.h"
 #include "TestThread.h"
@@ -830,6 +833,8 @@ void Map::UpdatePlayerZoneStats(uint32 oldZone, uint32 newZone)
 
 void Map::Update(const uint32& t_diff)
 {
+    PROFILE_ZONE("Map::Update", GetId());
+
     GameTime = time(nullptr);
     GameMSTime = GetMSTime();
 
@@ -909,7 +914,8 @@ void Map::Update(const uint32& t_diff)
 
     //must be done before creatures update
     for (auto itr : CreatureGroupHolder)
-        itr.second->Update(t_diff);
+        if (itr.second->NeedsUpdate())
+            itr.second->Update(t_diff);
     
     // non-player active objects, increasing iterator in the loop in case of object removal
     for (m_activeForcedNonPlayersIter = m_activeForcedNonPlayers.begin(); m_activeForcedNonPlayersIter != m_activeForcedNonPlayers.end();)
@@ -936,7 +942,10 @@ void Map::Update(const uint32& t_diff)
         obj->Update(t_diff);
     }
 
-    SendObjectUpdates();
+    {
+        PROFILE_ZONE("Map::SendObjectUpdates");
+        SendObjectUpdates();
+    }
 
     ///- Process necessary scripts
     if (!m_scriptSchedule.empty())
@@ -950,9 +959,14 @@ void Map::Update(const uint32& t_diff)
     MoveAllGameObjectsInMoveList();
 
     if (!m_mapRefManager.isEmpty() || !m_activeForcedNonPlayers.empty())
+    {
+        PROFILE_ZONE("Map::ProcessRelocationNotifies");
         ProcessRelocationNotifies(t_diff);
+    }
 
     sScriptMgr->OnMapUpdate(this, t_diff);
+
+    SendMovementPackets();
 }
 
 void Map::RemovePlayerFromMap(Player* player, bool remove)
@@ -2439,6 +2453,83 @@ void Map::SendObjectUpdates()
     }
 }
 
+void Map::AddMovementPacket(WorldPacket&& packet, std::vector<Player*> const& receivers)
+{
+    _movementPackets.push_back(std::move(packet));
+    uint32 const index = _movementPackets.size() - 1;
+    for (Player* receiver : receivers)
+        _movementPacketsByReceiver[receiver->GetGUID()].push_back(index);
+}
+
+void Map::SendMovementPackets()
+{
+    if (_movementPackets.empty())
+        return;
+
+    // SMSG_COMPRESSED_MOVES content: for each packet, uint8 size (opcode + data), uint16 opcode, data
+    ByteBuffer moves;
+    std::vector<uint32> movesIndexes;
+    WorldPacket packet;
+    auto sendMoves = [&](Player* player)
+    {
+        uint32 destSize = compressBound(moves.size());
+        packet.Initialize(SMSG_COMPRESSED_MOVES, destSize + sizeof(uint32));
+        packet.resize(destSize + sizeof(uint32));
+        packet.put(0, uint32(moves.size()));
+        UpdateData::Compress(const_cast<uint8*>(packet.contents()) + sizeof(uint32), &destSize, const_cast<uint8*>(moves.contents()), moves.size());
+        if (destSize)
+        {
+            packet.resize(destSize + sizeof(uint32));
+            player->SendDirectMessage(&packet);
+        }
+        else // compression failed, fall back to sending the moves one by one
+        {
+            for (uint32 index : movesIndexes)
+                player->SendDirectMessage(&_movementPackets[index]);
+        }
+        moves.clear();
+        movesIndexes.clear();
+    };
+
+    for (auto const& itr : _movementPacketsByReceiver)
+    {
+        Player* player = ObjectAccessor::GetPlayer(this, itr.first);
+        if (!player)
+            continue;
+
+        if (itr.second.size() == 1)
+        {
+            player->SendDirectMessage(&_movementPackets[itr.second.front()]);
+            continue;
+        }
+
+        for (uint32 index : itr.second)
+        {
+            WorldPacket const& move = _movementPackets[index];
+            if (move.size() + sizeof(uint16) > std::numeric_limits<uint8>::max())
+            {
+                // too big to be merged, keep order with the previous moves
+                if (moves.size())
+                    sendMoves(player);
+
+                player->SendDirectMessage(&move);
+                continue;
+            }
+
+            moves << uint8(move.size() + sizeof(uint16));
+            moves << uint16(move.GetOpcode());
+            moves.append(move.contents(), move.size());
+            movesIndexes.push_back(index);
+        }
+
+        if (moves.size())
+            sendMoves(player);
+    }
+
+    _movementPackets.clear();
+    _movementPacketsByReceiver.clear();
+}
+
 void Map::AddFarSpellCallback(FarSpellCallback&& callback)
 {
     _farSpellCallbacks.Enqueue(new FarSpellCallback(std::move(callback)));
@@ -16,13 +16,13 @@
 #include "Transaction.h"
 #include "SharedDefines.h"
 #include "Optional.h"
+#include "WorldPacket.h"
 
 #include <bitset>
 #include <list>
 #include <mutex>
 
 class Unit;
-class WorldPacket;
 class InstanceScript;
 class WorldObject;
 class CreatureGroup;
@@ -251,6 +251,9 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 			_updateObjects.erase(obj);
 		}
 
+        // Movement packet sent to receivers with the other movements of this update, see CONFIG_BATCH_MOVEMENT_PACKETS
+        void AddMovementPacket(WorldPacket&& packet, std::vector<Player*> const& receivers);
+
         virtual std::string GetDebugInfo() const;
 
         // some calls like isInWater should not use vmaps due to processor power
@@ -606,6 +609,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 		void ScriptsProcess();
 
 		void SendObjectUpdates();
+        void SendMovementPackets();
 
         bool AllTransportsEmpty() const; // sunwell
         void AllTransportsRemovePassengers(); // sunwell
@@ -809,6 +813,8 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
 		std::unordered_set<Corpse*> _corpseBones;
 
 		std::unordered_set<Object*> _updateObjects;
+        std::vector<WorldPacket> _movementPackets;
+        std::unordered_map<ObjectGuid, std::vector<uint32 /*index in _movementPackets*/>> _movementPacketsByReceiver;
         uint32 _lastMapUpdate;
 
         MPSCQueue<FarSpellCallback> _farSpellCallbacks;
@@ -3,16 +3,57 @@
 #include "BattleGroundMgr.h"
 #include "Language.h"
 #include "Chat.h"
+#include "Opcodes.h"
+
+uint32 const PacketSendLatencyInfo::BucketLimits[PacketSendLatencyInfo::BUCKET_COUNT - 1] = { 1000, 2000, 5000, 10000, 20000 };
+
+struct OpcodeCostTable
+{
+    //only written by the owning thread, atomics allow reading from other threads
+    struct Entry
+    {
+        std::atomic<uint64> count;
+        std::atomic<uint64> totalTime;
+        std::atomic<uint64> maxTime;
+        std::atomic<uint64> bytes;
+    };
+
+    explicit OpcodeCostTable(uint32 generation)
+    {
+        Clear();
+        this->generation.store(generation, std::memory_order_relaxed);
+    }
+
+    void Clear()
+    {
+        for (Entry& entry : entries)
+        {
+            entry.count.store(0, std::memory_order_relaxed);
+            entry.totalTime.store(0, std::memory_order_relaxed);
+            entry.maxTime.store(0, std::memory_order_relaxed);
+            entry.bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint32> generation;
+    Entry entries[NUM_OPCODE_HANDLERS];
+};
 
 Monitor::Monitor()
     : _worldTickCount(0),
-    _generalInfoTimer(0)
+    _generalInfoTimer(0),
+    _opcodeCostsGeneration(0),
+    _opcodeCostsLogTimer(0)
 {
     _worldTicksInfo.reserve(DAY * 20); //already prepare 1 day worth of 20 updates per seconds
 }
 
+Monitor::~Monitor() = default;
+
 void Monitor::Update(uint32 diff)
 {
+    LogOpcodeCostsIfExpired(diff);
+
     if (!sWorld->getConfig(CONFIG_MONITORING_ENABLED))
         return;
 
@@ -127,6 +168,118 @@ void Monitor::FinishedWorldLoop()
     _currentWorldTickInfo = {};
 }
 
+void Monitor::PlayerSaved(uint32 rows, bool fullSave)
+{
+    _playerSaves.saves++;
+    if (fullSave)
+        _playerSaves.fullSaves++;
+    _playerSaves.rows += rows;
+
+    uint32 maxRows = _playerSaves.maxRows;
+    while (rows > maxRows && !_playerSaves.maxRows.compare_exchange_weak(maxRows, rows));
+}
+
+void Monitor::PacketSent(uint32 latencyUs)
+{
+    uint32 bucket = 0;
+    while (bucket < PacketSendLatencyInfo::BUCKET_COUNT - 1 && latencyUs >= PacketSendLatencyInfo::BucketLimits[bucket])
+        ++bucket;
+
+    _packetSendLatency.buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    _packetSendLatency.count.fetch_add(1, std::memory_order_relaxed);
+    _packetSendLatency.totalLatency.fetch_add(latencyUs, std::memory_order_relaxed);
+}
+
+void Monitor::OpcodeHandled(uint16 opcode, uint32 size, uint64 timeNs)
+{
+    if (opcode >= NUM_OPCODE_HANDLERS)
+        return;
+
+    static thread_local OpcodeCostTable* table = nullptr;
+    uint32 generation = _opcodeCostsGeneration.load(std::memory_order_relaxed);
+    if (!table)
+    {
+        std::lock_guard<std::mutex> lock(_opcodeCostTablesLock);
+        _opcodeCostTables.push_back(std::make_unique<OpcodeCostTable>(generation));
+        table = _opcodeCostTables.back().get();
+    }
+    else if (table->generation.load(std::memory_order_relaxed) != generation)
+    {
+        table->Clear();
+        table->generation.store(generation, std::memory_order_release);
+    }
+
+    //single writer, no need for atomic read-modify-write
+    OpcodeCostTable::Entry& entry = table->entries[opcode];
+    entry.count.store(entry.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    entry.totalTime.store(entry.totalTime.load(std::memory_order_relaxed) + timeNs, std::memory_order_relaxed);
+    entry.bytes.store(entry.bytes.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+    if (timeNs > entry.maxTime.load(std::memory_order_relaxed))
+        entry.maxTime.store(timeNs, std::memory_order_relaxed);
+}
+
+std::vector<OpcodeCostInfo> Monitor::GetOpcodeCosts()
+{
+    std::vector<OpcodeCostInfo> costs(NUM_OPCODE_HANDLERS);
+    uint32 generation = _opcodeCostsGeneration.load(std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(_opcodeCostTablesLock);
+        for (std::unique_ptr<OpcodeCostTable> const& table : _opcodeCostTables)
+        {
+            if (table->generation.load(std::memory_order_acquire) != generation)
+                continue; //not cleared yet since last reset
+
+            for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+            {
+                OpcodeCostTable::Entry const& entry = table->entries[opcode];
+                OpcodeCostInfo& cost = costs[opcode];
+                cost.count += entry.count.load(std::memory_order_relaxed);
+                cost.totalTime += entry.totalTime.load(std::memory_order_relaxed);
+                cost.maxTime = std::max(cost.maxTime, entry.maxTime.load(std::memory_order_relaxed));
+                cost.bytes += entry.bytes.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (uint32 opcode = 0; opcode < NUM_OPCODE_HANDLERS; ++opcode)
+        costs[opcode].opcode = opcode;
+
+    costs.erase(std::remove_if(costs.begin(), costs.end(), [](OpcodeCostInfo const& cost) { return cost.count == 0; }), costs.end());
+    std::sort(costs.begin(), costs.end(), [](OpcodeCostInfo const& left, OpcodeCostInfo const& right) { return left.totalTime > right.totalTime; });
+    return costs;
+}
+
+void Monitor::ResetOpcodeCosts()
+{
+    ++_opcodeCostsGeneration;
+}
+
+void Monitor::LogOpcodeCostsIfExpired(uint32 diff)
+{
+    uint32 logInterval = IN_MILLISECONDS * sWorld->getConfig(CONFIG_MONITORING_OPCODE_COSTS_LOG_INTERVAL);
+    if (!logInterval || !sWorld->getConfig(CONFIG_MONITORING_OPCODE_COSTS))
+        return;
+
+    _opcodeCostsLogTimer += diff;
+    if (_opcodeCostsLogTimer < logInterval)
+        return;
+
+    _opcodeCostsLogTimer = 0;
+
+    std::vector<OpcodeCostInfo> costs = GetOpcodeCosts();
+    if (costs.empty())
+        return;
+
+    uint32 const maxLogged = 10;
+    TC_LOG_INFO("profiling", "Most expensive client opcodes since startup or last reset:");
+    for (uint32 i = 0; i < costs.size() && i < maxLogged; ++i)
+    {
+        OpcodeCostInfo const& cost = costs[i];
+        TC_LOG_INFO("profiling", "%s: " UI64FMTD " packets, total " UI64FMTD " us, avg " UI64FMTD " ns, max " UI64FMTD " us, " UI64FMTD " bytes",
+            GetOpcodeNameForLogging(static_cast<OpcodeClient>(cost.opcode)).c_str(), cost.count, cost.totalTime / 1000, cost.totalTime / cost.count, cost.maxTime / 1000, cost.bytes);
+    }
+}
+
 void Monitor::UpdateGeneralInfosIfExpired(uint32 diff)
 {
     uint32 generalInfosUpdateTimeout = IN_MILLISECONDS * sWorld->getConfig(CONFIG_MONITORING_GENERALINFOS_UPDATE);
@@ -1,9 +1,11 @@
 #ifndef __MONITOR_H
 #define __MONITOR_H
 
+#include <atomic>
+#include <memory>
+
 /*
 Ideas:
-- Allow to trigger profiling at next udpate, by command or automatically every X according to config
 - Some form of packet monitoring?
 - A command basically checking "WHY DO I LAG?" enabling various checks for one loop
 */
@@ -88,11 +90,48 @@ private:
 	uint32 count = 0;
 };
 
+//Player::SaveToDB statistics since startup. Updated from map threads.
+struct PlayerSavesInfo
+{
+	std::atomic<uint64> saves{ 0 };
+	std::atomic<uint64> fullSaves{ 0 };
+	std::atomic<uint64> rows{ 0 }; //statements written in save transactions
+	std::atomic<uint32> maxRows{ 0 };
+	//PlayerSaveQueue
+	std::atomic<uint64> queued{ 0 };
+	std::atomic<uint64> coalesced{ 0 }; //autosave requests for a player already queued
+	std::atomic<uint64> throttledUpdates{ 0 }; //world updates limited to one save because of character db queue size
+};
+
+//Delay between WorldSocket::SendPacket and the packet being handed to the socket write queue, since startup. Updated from network threads. Only recorded with Monitor.PacketSendLatency.Enable.
+struct PacketSendLatencyInfo
+{
+	static uint32 const BUCKET_COUNT = 6;
+	static uint32 const BucketLimits[BUCKET_COUNT - 1]; //upper limits in microseconds, last bucket has the rest
+
+	std::atomic<uint64> buckets[BUCKET_COUNT]{ };
+	std::atomic<uint64> count{ 0 };
+	std::atomic<uint64> totalLatency{ 0 }; //microseconds
+};
+
+//Client opcode handling cost since startup or last reset, summed over all threads updating sessions. Only recorded with Monitor.OpcodeCosts.Enable.
+struct OpcodeCostInfo
+{
+	uint16 opcode = 0;
+	uint64 count = 0;
+	uint64 totalTime = 0; //nanoseconds
+	uint64 maxTime = 0; //nanoseconds
+	uint64 bytes = 0;
+};
+
+struct OpcodeCostTable;
+
 class TC_GAME_API Monitor
 {
 	friend class MapUpdater;
 	friend class World;
 	friend class MapUpdateRequest;
+	friend class PlayerSaveQueue;
 
 
 public:
@@ -110,6 +149,20 @@ public:
 
 	// Flattened timediff upated every minute. This is a cached value.
 	uint32 GetSmoothTimeDiff() const { return smoothTD.Get(); }
+
+	// Called at each player save with the statement count of the save transaction
+	void PlayerSaved(uint32 rows, bool fullSave);
+	PlayerSavesInfo const& GetPlayerSavesInfo() const { return _playerSaves; }
+
+	// Called from network threads for each packet written
+	void PacketSent(uint32 latencyUs);
+	PacketSendLatencyInfo const& GetPacketSendLatencyInfo() const { return _packetSendLatency; }
+
+	// Called from the thread updating the session for each client packet handled. Each thread accumulates in its own table.
+	void OpcodeHandled(uint16 opcode, uint32 size, uint64 timeNs);
+	// Opcodes handled at least once, most expensive total time first
+	std::vector<OpcodeCostInfo> GetOpcodeCosts();
+	void ResetOpcodeCosts();
 private:
 	// -- MapUpdater & World functions
 	void MapUpdateStart(Map const& map);
@@ -122,9 +175,11 @@ private:
 
 
 	Monitor();
+	~Monitor();
 
 	void UpdateGeneralInfosIfExpired(uint32 diff);
 	void UpdateGeneralInfos(uint32 diff);
+	void LogOpcodeCostsIfExpired(uint32 diff);
 
 	WorldTick _worldTickCount;
 
@@ -149,6 +204,15 @@ private:
 	MonitorAlert      _monitAlert;
 
 	SmoothedTimeDiff smoothTD;
+
+	PlayerSavesInfo _playerSaves;
+	PacketSendLatencyInfo _packetSendLatency;
+
+	//one table per thread which handled packets, never removed. Tables from an older generation are cleared by their thread at next write.
+	std::mutex _opcodeCostTablesLock;
+	std::vector<std::unique_ptr<OpcodeCostTable>> _opcodeCostTables;
+	std::atomic<uint32> _opcodeCostsGeneration;
+	uint32 _opcodeCostsLogTimer;
 };
 
 #define sMonitor Monitor::instance()
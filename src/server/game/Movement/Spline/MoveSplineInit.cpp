@@ -6,6 +6,10 @@
 #include "Transport.h"
 #include "WorldPacket.h"
 #include "Opcodes.h"
+#include "CellImpl.h"
+#include "GridNotifiers.h"
+#include "Map.h"
+#include "World.h"
 
 namespace Movement
 {
@@ -38,6 +42,25 @@ namespace Movement
         return MOVE_RUN;
     }
 
+    // send to player having this unit in sight, merged with other movements of the map update if enabled
+    void SendMoveToSet(Unit* unit, WorldPacket&& data)
+    {
+        // players must receive their own moves in order with their other movement packets
+        if (!sWorld->getBoolConfig(CONFIG_BATCH_MOVEMENT_PACKETS) || unit->GetTypeId() == TYPEID_PLAYER || !unit->IsInWorld())
+        {
+            unit->SendMessageToSet(&data, true);
+            return;
+        }
+
+        // same range as WorldObject::SendMessageToSet
+        float const dist = unit->GetVisibilityRange() + unit->GetCombatReach() + VISIBILITY_COMPENSATION;
+        std::vector<Player*> receivers;
+        Trinity::MessageDistDeliverer notifier(unit, &data, dist, false, nullptr, &receivers);
+        Cell::VisitWorldObjects(unit, notifier, dist);
+        if (!receivers.empty())
+            unit->GetMap()->AddMovementPacket(std::move(data), receivers);
+    }
+
     // send to player having this unit in sight
     void SendLaunchToSet(Unit* unit, bool transport)
     {
@@ -53,7 +76,7 @@ namespace Movement
         }
 
         PacketBuilder::WriteMonsterMove(*(unit->movespline), data);
-        unit->SendMessageToSet(&data, true);
+        SendMoveToSet(unit, std::move(data));
     }
 
     int32 MoveSplineInit::Launch()
@@ -189,7 +212,7 @@ namespace Movement
         loc.z += unit->GetHoverOffset();
 
         PacketBuilder::WriteStopMovement(loc, args.splineId, data);
-        unit->SendMessageToSet(&data, true);
+        SendMoveToSet(unit, std::move(data));
         //SendStopToSet(unit, transport, loc, args.splineId);
     }
 
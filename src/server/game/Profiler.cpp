@@ -1,9 +1,41 @@
 #include "Profiler.h"
+#include "Log.h"
+#include "World.h"
 #include <sstream>
 #ifdef USE_GPERFTOOLS
     #include <gperftools/profiler.h>
 #endif
 
+struct ProfileZoneEvent
+{
+    char const* name;
+    uint64 start;       // nanoseconds since profiler creation
+    uint64 duration;    // nanoseconds
+    uint32 data;
+};
+
+struct ProfileZoneBuffer
+{
+    static uint32 const CAPACITY = 1 << 16;
+
+    // only written by the owning thread, oldest events are overwritten
+    std::atomic<uint64> written{ 0 };
+    ProfileZoneEvent events[CAPACITY];
+};
+
+Profiler::Profiler()
+    : _zoneEpoch(std::chrono::steady_clock::now()),
+    _recordZones(false),
+    _tickStart(0),
+    _captureTicksLeft(0),
+    _captureStarted(false),
+    _captureStart(0),
+    _lastSlowTickDump(0)
+{
+}
+
+Profiler::~Profiler() = default;
+
 bool Profiler::Start(std::string filename, std::string& failureReason)
 {
 #ifdef USE_GPERFTOOLS
@@ -94,3 +126,149 @@ std::string Profiler::GetInfos() const
 
 }
 
+
+ProfileZoneBuffer* Profiler::GetThreadZoneBuffer()
+{
+    static thread_local ProfileZoneBuffer* buffer = nullptr;
+    if (!buffer)
+    {
+        std::lock_guard<std::mutex> lock(_zoneBuffersLock);
+        _zoneBuffers.push_back(std::make_unique<ProfileZoneBuffer>());
+        buffer = _zoneBuffers.back().get();
+    }
+    return buffer;
+}
+
+void Profiler::RecordZone(char const* name, uint32 data, uint64 start, uint64 end)
+{
+    ProfileZoneBuffer* buffer = GetThreadZoneBuffer();
+    uint64 written = buffer->written.load(std::memory_order_relaxed);
+    ProfileZoneEvent& event = buffer->events[written % ProfileZoneBuffer::CAPACITY];
+    event.name = name;
+    event.start = start;
+    event.duration = end - start;
+    event.data = data;
+    buffer->written.store(written + 1, std::memory_order_release);
+}
+
+bool Profiler::StartZoneCapture(uint32 ticks, std::string filename, std::string& failureReason)
+{
+    if (_captureTicksLeft)
+    {
+        failureReason = "A capture is already running";
+        return false;
+    }
+
+    if (!ticks)
+    {
+        failureReason = "Tick count must be greater than 0";
+        return false;
+    }
+
+    _captureTicksLeft = ticks;
+    _captureStarted = false;
+    _captureFilename = std::move(filename);
+    return true;
+}
+
+void Profiler::WorldTickStarted()
+{
+    _tickStart = GetZoneTime();
+    if (_captureTicksLeft && !_captureStarted)
+    {
+        _captureStarted = true;
+        _captureStart = _tickStart;
+    }
+
+    _recordZones.store(_captureTicksLeft || sWorld->getConfig(CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP), std::memory_order_relaxed);
+}
+
+void Profiler::WorldTickEnded()
+{
+    if (!_recordZones.load(std::memory_order_relaxed))
+        return;
+
+    uint64 now = GetZoneTime();
+    if (_captureTicksLeft)
+    {
+        if (!_captureStarted || --_captureTicksLeft)
+            return;
+
+        if (WriteZoneTrace(_captureFilename, _captureStart, now))
+            TC_LOG_INFO("profiling", "Zone capture written to %s", _captureFilename.c_str());
+        return;
+    }
+
+    uint64 slowTickDiff = uint64(sWorld->getConfig(CONFIG_MONITORING_ABNORMAL_WORLD_UPDATE_DIFF)) * 1000000;
+    uint64 cooldown = uint64(sWorld->getConfig(CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP_COOLDOWN)) * 1000000000;
+    if (!slowTickDiff || now - _tickStart < slowTickDiff)
+        return;
+
+    if (_lastSlowTickDump && now - _lastSlowTickDump < cooldown)
+        return;
+
+    _lastSlowTickDump = now;
+    std::string filename = sLog->GetLogsDir() + "slowtick_" + std::to_string(time(nullptr)) + ".json";
+    if (WriteZoneTrace(filename, _tickStart, now))
+        TC_LOG_INFO("profiling", "World update took %u ms, zones written to %s", uint32((now - _tickStart) / 1000000), filename.c_str());
+}
+
+bool Profiler::WriteZoneTrace(std::string const& filename, uint64 from, uint64 to)
+{
+    FILE* file = fopen(filename.c_str(), "w");
+    if (!file)
+    {
+        TC_LOG_ERROR("profiling", "Could not open %s to write zone trace", filename.c_str());
+        return false;
+    }
+
+    bool truncated = false;
+    bool first = true;
+    fputs("{\"traceEvents\":[\n", file);
+
+    std::lock_guard<std::mutex> lock(_zoneBuffersLock);
+    for (uint32 thread = 0; thread < _zoneBuffers.size(); ++thread)
+    {
+        ProfileZoneBuffer const& buffer = *_zoneBuffers[thread];
+        uint64 written = buffer.written.load(std::memory_order_acquire);
+        uint64 oldest = written > ProfileZoneBuffer::CAPACITY ? written - ProfileZoneBuffer::CAPACITY : 0;
+        if (oldest && buffer.events[oldest % ProfileZoneBuffer::CAPACITY].start > from)
+            truncated = true;
+
+        for (uint64 i = oldest; i < written; ++i)
+        {
+            ProfileZoneEvent const& event = buffer.events[i % ProfileZoneBuffer::CAPACITY];
+            if (event.start < from || event.start >= to)
+                continue;
+
+            fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                first ? "" : ",\n", event.name, thread, event.start / 1000.0, event.duration / 1000.0);
+            if (event.data)
+                fprintf(file, ",\"args\":{\"data\":%u}", event.data);
+            fputc('}', file);
+            first = false;
+        }
+    }
+
+    fputs("\n]}\n", file);
+    fclose(file);
+
+    if (truncated)
+        TC_LOG_WARN("profiling", "Zone trace %s is missing the oldest zones, more were recorded than per thread buffers can hold", filename.c_str());
+
+    return true;
+}
+
+std::string Profiler::GetZoneInfos() const
+{
+    std::stringstream infos;
+    if (_captureTicksLeft)
+        infos << "Zone capture running, " << _captureTicksLeft << " world updates left, writing to " << _captureFilename;
+    else
+        infos << "No zone capture running";
+
+    if (sWorld->getConfig(CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP))
+        infos << std::endl << "Zones of slow world updates are written to logs directory";
+
+    return infos.str();
+}
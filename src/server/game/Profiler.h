@@ -1,6 +1,14 @@
 #ifndef __PROFILER_H
 #define __PROFILER_H
 
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+struct ProfileZoneBuffer;
+
 class TC_GAME_API Profiler
 {
 public:
@@ -21,10 +29,70 @@ public:
 	bool IsRunning() const;
 	std::string GetInfos() const;
 
+	// -- Zone profiler
+	/* PROFILE_ZONE scopes are recorded in a ring buffer per thread while a capture is running, or all the time with
+	Profiler.Zones.SlowTickDump. Traces are written in Chrome trace format (chrome://tracing, Perfetto, speedscope).
+	*/
+	// Record zones of all threads for the next <ticks> world updates then write them to filename. World thread only.
+	bool StartZoneCapture(uint32 ticks, std::string filename, std::string& failureReason);
+	bool IsRecordingZones() const { return _recordZones.load(std::memory_order_relaxed); }
+	// Nanoseconds since profiler creation
+	uint64 GetZoneTime() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - _zoneEpoch).count(); }
+	void RecordZone(char const* name, uint32 data, uint64 start, uint64 end);
+	// Called by World::Update. Traces are written at tick end, while map threads are idle.
+	void WorldTickStarted();
+	void WorldTickEnded();
+	std::string GetZoneInfos() const;
+
 private:
-	Profiler() {}
+	Profiler();
+	~Profiler();
+
+	ProfileZoneBuffer* GetThreadZoneBuffer();
+	bool WriteZoneTrace(std::string const& filename, uint64 from, uint64 to);
+
+	std::chrono::steady_clock::time_point const _zoneEpoch;
+	std::atomic<bool> _recordZones;
+
+	std::mutex _zoneBuffersLock;
+	std::vector<std::unique_ptr<ProfileZoneBuffer>> _zoneBuffers;
+
+	// world thread only
+	uint64 _tickStart;
+	uint32 _captureTicksLeft;   // capture requested or running
+	bool _captureStarted;
+	uint64 _captureStart;
+	std::string _captureFilename;
+	uint64 _lastSlowTickDump;
 };
 
 #define sProfiler Profiler::instance()
 
+/* Record the enclosing scope under given name while zones are recorded. Name must have static storage (string literal).
+An optional uint32 argument (map id, entry...) is shown with the zone in the trace.
+*/
+class ProfileZone
+{
+public:
+    explicit ProfileZone(char const* name, uint32 data = 0) : _name(name), _data(data), _recording(sProfiler->IsRecordingZones()), _start(_recording ? sProfiler->GetZoneTime() : 0) { }
+    ~ProfileZone()
+    {
+        if (_recording)
+            sProfiler->RecordZone(_name, _data, _start, sProfiler->GetZoneTime());
+    }
+
+    ProfileZone(ProfileZone const&) = delete;
+    ProfileZone& operator=(ProfileZone const&) = delete;
+
+private:
+    char const* _name;
+    uint32 _data;
+    bool _recording;
+    uint64 _start;
+};
+
+#define PROFILE_ZONE_CONCAT_(a, b) a##b
+#define PROFILE_ZONE_CONCAT(a, b) PROFILE_ZONE_CONCAT_(a, b)
+#define PROFILE_ZONE(...) ProfileZone PROFILE_ZONE_CONCAT(profileZone, __LINE__)(__VA_ARGS__)
+
 #endif // __PROFILER_H
@@ -22,8 +22,12 @@
 #include "Timer.h"
 #include "Log.h"
 #include "Opcodes.h"
+#include "Util.h"
 #include <iomanip>
 
+#define PACKET_LOG_FILE_BUFFER_SIZE (1024 * 1024)
+#define PACKET_LOG_WRITER_SLEEP 10
+
 #pragma pack(push, 1)
 
 // Packet logging structures in PKT 3.1 format
@@ -60,13 +64,19 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(NULL)
+PacketLog::PacketLog() : _file(NULL), _maxPending(0), _pending(0), _dropped(0), _stopWriter(false)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
 }
 
 PacketLog::~PacketLog()
 {
+    if (_writerThread.joinable())
+    {
+        _stopWriter = true;
+        _writerThread.join();
+    }
+
     if (_file)
         fclose(_file);
 
@@ -85,6 +95,13 @@ void PacketLog::Initialize()
     if (!logname.empty())
     {
         _file = fopen((logsDir + logname).c_str(), "wb");
+        if (!_file)
+        {
+            TC_LOG_ERROR("server.loading", "PacketLog: could not open %s", (logsDir + logname).c_str());
+            return;
+        }
+
+        setvbuf(_file, NULL, _IOFBF, PACKET_LOG_FILE_BUFFER_SIZE);
 
         LogHeader header;
         header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
@@ -98,12 +115,54 @@ void PacketLog::Initialize()
         header.OptionalDataSize = 0;
 
         fwrite(&header, sizeof(header), 1, _file);
+
+        Tokenizer accounts(sConfigMgr->GetStringDefault("PacketLog.Accounts", ""), ' ');
+        for (char const* account : accounts)
+            if (uint32 accountId = uint32(atoi(account)))
+                _accounts.insert(accountId);
+
+        _maxPending = sConfigMgr->GetIntDefault("PacketLog.MaxPending", 100000);
+        _writerThread = std::thread(&PacketLog::WriterThread, this);
     }
 }
 
-void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address addr, uint16 port)
+void PacketLog::WriterThread()
 {
-    std::lock_guard<std::mutex> lock(_logPacketLock);
+    while (true)
+    {
+        // checked before draining so that everything queued before stopping gets written
+        bool stopping = _stopWriter;
+
+        std::vector<uint8>* entry;
+        bool wrote = false;
+        while (_queue.Dequeue(entry))
+        {
+            --_pending;
+            fwrite(entry->data(), 1, entry->size(), _file);
+            delete entry;
+            wrote = true;
+        }
+
+        if (wrote)
+            fflush(_file);
+
+        if (stopping)
+            break;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(PACKET_LOG_WRITER_SLEEP));
+    }
+}
+
+void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address addr, uint16 port, uint32 accountId)
+{
+    if (!_accounts.empty() && _accounts.find(accountId) == _accounts.end())
+        return;
+
+    if (_maxPending && _pending >= _maxPending)
+    {
+        ++_dropped;
+        return;
+    }
 
     PacketHeader header;
     *reinterpret_cast<uint32*>(header.Direction) = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
@@ -127,11 +186,13 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     header.Length = packet.size() + sizeof(header.Opcode);
     header.Opcode = packet.GetOpcode();
 
-    fwrite(&header, sizeof(header), 1, _file);
+    std::vector<uint8>* entry = new std::vector<uint8>(sizeof(header) + packet.size());
+    memcpy(entry->data(), &header, sizeof(header));
     if (!packet.empty())
-        fwrite(packet.contents(), 1, packet.size(), _file);
+        memcpy(entry->data() + sizeof(header), packet.contents(), packet.size());
 
-    fflush(_file);
+    ++_pending;
+    _queue.Enqueue(entry);
 }
 
 void PacketLog::DumpPacket(LogLevel const level, Direction const dir, WorldPacket const& packet, std::string const& comment)
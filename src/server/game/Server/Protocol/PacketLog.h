@@ -19,9 +19,14 @@
 #define TRINITY_PACKETLOG_H
 
 #include "Appender.h"
+#include "MPSCQueue.h"
 
 #include <boost/asio/ip/address.hpp>
+#include <atomic>
 #include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 
 enum Direction
 {
@@ -31,14 +36,18 @@ enum Direction
 
 class WorldPacket;
 
+/* Packets are queued by the network and map threads without locking and written to the file
+by a single writer thread, with stdio buffering. Packets are dropped if more than PacketLog.MaxPending
+are waiting for the writer. */
 class PacketLog
 {
     private:
         PacketLog();
         ~PacketLog();
-        std::mutex _logPacketLock;
         std::once_flag _initializeFlag;
 
+        void WriterThread();
+
     public:
         static PacketLog* instance()
         {
@@ -48,12 +57,23 @@ class PacketLog
 
         void Initialize();
         bool CanLogPacket() const { return (_file != NULL); }
-        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address addr, uint16 port);
+        // accountId is 0 before authentication
+        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address addr, uint16 port, uint32 accountId);
+        // packets not logged because the writer thread was behind
+        uint64 GetDroppedCount() const { return _dropped; }
 
         //will dump packet to log with filter "network.opcode"
         static void DumpPacket(LogLevel const level, Direction const dir, WorldPacket const& packet, std::string const& comment);
     private:
         FILE* _file;
+        std::unordered_set<uint32> _accounts; // log only those accounts if not empty
+        uint32 _maxPending;
+
+        MPSCQueue<std::vector<uint8>> _queue;
+        std::atomic<uint32> _pending;
+        std::atomic<uint64> _dropped;
+        std::atomic<bool> _stopWriter;
+        std::thread _writerThread;
 };
 
 #define sPacketLog PacketLog::instance()
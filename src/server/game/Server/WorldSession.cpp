@@ -39,6 +39,7 @@
 #include "ReplayPlayer.h"
 #include "PlayerAntiCheat.h"
 #include "GuildMgr.h"
+#include "Monitor.h"
 
 #ifdef PLAYERBOT
 #include "playerbot.h"
@@ -159,7 +160,7 @@ WorldSession::~WorldSession()
 
     ///- empty incoming packet queue
     WorldPacket* packet = nullptr;
-    while (_recvQueue.next(packet))
+    while (NextRecvPacket(packet))
         delete packet;
 
     LoginDatabase.AsyncPQuery("UPDATE account SET online = 0 WHERE id = %u;", GetAccountId());
@@ -251,7 +252,27 @@ void WorldSession::SendPacket(WorldPacket const* packet)
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
     anticheat.OnClientPacketReceived(*new_packet);
-    _recvQueue.add(new_packet);
+    _recvQueue.Enqueue(new_packet);
+}
+
+bool WorldSession::NextRecvPacket(WorldPacket*& packet, PacketFilter* filter)
+{
+    if (_recvPending.empty())
+    {
+        WorldPacket* received;
+        while (_recvQueue.Dequeue(received))
+            _recvPending.push_back(received);
+
+        if (_recvPending.empty())
+            return false;
+    }
+
+    if (filter && !filter->Process(_recvPending.front()))
+        return false;
+
+    packet = _recvPending.front();
+    _recvPending.pop_front();
+    return true;
 }
 
 /// Logging helper for unexpected opcodes
@@ -317,7 +338,9 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     if(_player)
         _player->SetHasMovedInUpdate(false);
 
-    while (m_Socket && _recvQueue.next(packet, updater))
+    bool const recordOpcodeCosts = sWorld->getConfig(CONFIG_MONITORING_OPCODE_COSTS);
+
+    while (m_Socket && NextRecvPacket(packet, &updater))
     {
         //if replaying record, skip most packets
         if (m_replayPlayer)
@@ -329,6 +352,10 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
         ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
 
+        std::chrono::steady_clock::time_point handleStartTime;
+        if (recordOpcodeCosts)
+            handleStartTime = std::chrono::steady_clock::now();
+
         try
         {
             switch (opHandle->Status)
@@ -431,6 +458,11 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             packet->hexlike();
         }
 
+        //requeued packets are counted when handled
+        if (recordOpcodeCosts && deletePacket)
+            sMonitor->OpcodeHandled(packet->GetOpcode(), uint32(packet->size()),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - handleStartTime).count());
+
         if (deletePacket)
             delete packet;
 
@@ -453,7 +485,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
         GetPlayer()->GetPlayerbotMgr()->UpdateSessions(0);
     #endif
 
-    _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+    _recvPending.insert(_recvPending.begin(), requeuePackets.begin(), requeuePackets.end());
 
     if (_player && _player->IsRepopPending() && !GetClientControl().HasPendingMovementChange())
         _player->RepopAtGraveyard();
@@ -1637,7 +1669,7 @@ void WorldSession::HandleSpellClick(WorldPacket& recvData)
 void WorldSession::HandleBotPackets()
 {
     WorldPacket* packet;
-    while (_recvQueue.next(packet))
+    while (NextRecvPacket(packet))
     {
         ClientOpcodeHandler const* opHandle = opcodeTable[static_cast<OpcodeClient>(packet->GetOpcode())];
         opHandle->Call(this, *packet);
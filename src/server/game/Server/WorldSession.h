@@ -10,7 +10,9 @@
 #include "QueryCallback.h"
 #include "PlayerAntiCheat.h"
 #include "World.h"
+#include "MPSCQueue.h"
 
+#include <deque>
 #include <string>
 
 class PlayerAntiCheat;
@@ -969,6 +971,9 @@ class TC_GAME_API WorldSession
         void LogUnexpectedOpcode(WorldPacket* packet, const char* status, const char *reason);
         void LogUnprocessedTail(WorldPacket* packet);
 
+        // Pop the oldest received packet if filter accepts it. Only called from the thread currently updating the session.
+        bool NextRecvPacket(WorldPacket*& packet, PacketFilter* filter = nullptr);
+
         // EnumData helpers
         bool IsLegitCharacterForAccount(ObjectGuid::LowType lowGUID)
         {
@@ -1015,7 +1020,11 @@ class TC_GAME_API WorldSession
         bool forceExit;
         ObjectGuid m_currentBankerGUID;
 
-        LockedQueue<WorldPacket*> _recvQueue;
+        /* Incoming packets are pushed lock free by the network thread into _recvQueue, then moved to _recvPending by the
+        thread updating the session (map thread or world thread, never both at once). Packets stay in reception order in a
+        single queue: a filter stops at the first packet it can't handle instead of skipping it. */
+        MPSCQueue<WorldPacket> _recvQueue;
+        std::deque<WorldPacket*> _recvPending;
 
         std::shared_ptr<ReplayRecorder> m_replayRecorder;
         std::shared_ptr<ReplayPlayer> m_replayPlayer;
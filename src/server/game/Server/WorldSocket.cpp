@@ -9,6 +9,7 @@
 #include "QueryHolder.h"
 #include "DatabaseEnv.h"
 #include "AccountMgr.h"
+#include "Monitor.h"
 #include "ServerPktHeader.h"
 #include <boost/asio/ip/tcp.hpp>
 #include "LogsDatabaseAccessor.h"
@@ -16,18 +17,22 @@
 class EncryptablePacket : public WorldPacket
 {
 public:
-    EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt) { }
+    EncryptablePacket(WorldPacket const& packet, bool encrypt, bool recordQueueTime) : WorldPacket(packet), _encrypt(encrypt),
+        _queueTime(recordQueueTime ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point()) { }
 
     bool NeedsEncryption() const { return _encrypt; }
+    // default time point if queued without Monitor.PacketSendLatency.Enable
+    std::chrono::steady_clock::time_point GetQueueTime() const { return _queueTime; }
 
 private:
     bool _encrypt;
+    std::chrono::steady_clock::time_point _queueTime;
 };
 
 using boost::asio::ip::tcp;
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
-    : Socket(std::move(socket)), _authSeed(rand32()), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _authCrypt(nullptr), _sendBufferSize(4096)
+    : Socket(std::move(socket)), _authSeed(rand32()), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _authCrypt(nullptr), _sendBufferSize(4096), _flushPending(false), _accountId(0)
 {
     _headerBuffer.Resize(sizeof(ClientPktHeader));
 }
@@ -78,34 +83,65 @@ void WorldSocket::CheckIpCallback(PreparedQueryResult result)
 
 bool WorldSocket::Update()
 {
+    WriteQueuedPackets();
+
+    if (!BaseSocket::Update())
+        return false;
+
+    _queryProcessor.ProcessReadyQueries();
+
+    return true;
+}
+
+void WorldSocket::HandleFlush()
+{
+    // cleared before draining, packets queued from now on either get written below or schedule another flush
+    _flushPending = false;
+
+    if (!IsOpen())
+        return;
+
+    WriteQueuedPackets();
+    BaseSocket::Update();
+}
+
+void WorldSocket::WriteQueuedPackets()
+{
+    bool const recordLatency = sWorld->getConfig(CONFIG_MONITORING_PACKET_SEND_LATENCY);
+    std::chrono::steady_clock::time_point now = recordLatency ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
     EncryptablePacket* queued;
     MessageBuffer buffer(_sendBufferSize);
     while (_bufferQueue.Dequeue(queued))
     {
+        if (recordLatency && queued->GetQueueTime() != std::chrono::steady_clock::time_point())
+            sMonitor->PacketSent(uint32(std::chrono::duration_cast<std::chrono::microseconds>(now - queued->GetQueueTime()).count()));
+
         ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
         if (_authCrypt && queued->NeedsEncryption())
             _authCrypt->EncryptSend(header.header, header.getHeaderLength());
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
-        {
-            QueuePacket(std::move(buffer));
-            buffer.Resize(_sendBufferSize);
-        }
-
         if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
         {
             buffer.Write(header.header, header.getHeaderLength());
             if (!queued->empty())
                 buffer.Write(queued->contents(), queued->size());
         }
-        else    // single packet larger than 4096 bytes
+        else
         {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
-            packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+            // packet doesn't fit, end current buffer with its header and queue its content from its own storage,
+            // socket writes both with a single gather write
+            if (buffer.GetRemainingSpace() < header.getHeaderLength())
+            {
+                QueuePacket(std::move(buffer));
+                buffer.Resize(_sendBufferSize);
+            }
+
+            buffer.Write(header.header, header.getHeaderLength());
+            QueuePacket(std::move(buffer));
+            buffer.Resize(_sendBufferSize);
 
-            QueuePacket(std::move(packetBuffer));
+            QueuePacket(MessageBuffer(queued->Move()));
         }
 
         delete queued;
@@ -113,13 +149,6 @@ bool WorldSocket::Update()
 
     if (buffer.GetActiveSize() > 0)
         QueuePacket(std::move(buffer));
-
-    if (!BaseSocket::Update())
-        return false;
-
-    _queryProcessor.ProcessReadyQueries();
-
-    return true;
 }
 
 void WorldSocket::HandleSendAuthSession()
@@ -312,7 +341,7 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     WorldPacket packet(opcode, std::move(_packetBuffer));
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort());
+        sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort(), _accountId);
 
     if (sWorld->getConfig(CONFIG_DEBUG_LOG_ALL_PACKETS))
         sPacketLog->DumpPacket(LOG_LEVEL_TRACE, CLIENT_TO_SERVER, packet, _worldSession ? _worldSession->GetPlayerInfo() : GetRemoteIpAddress().to_string());
@@ -422,7 +451,7 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         return;
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), _accountId);
 
     if (sWorld->getConfig(CONFIG_DEBUG_LOG_ALL_PACKETS))
         sPacketLog->DumpPacket(LOG_LEVEL_TRACE, SERVER_TO_CLIENT, packet, _worldSession ? _worldSession->GetPlayerInfo() : GetRemoteIpAddress().to_string());
@@ -434,7 +463,12 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
             _lastPacketsSent.push_back(packet);
     }
 
-    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt && _authCrypt->IsInitialized()));
+    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt && _authCrypt->IsInitialized(), sWorld->getConfig(CONFIG_MONITORING_PACKET_SEND_LATENCY)));
+
+    // Wake the network thread for the first packet queued since the last flush instead of waiting for its next update.
+    // Packets queued until the flush runs are written together with it.
+    if (!_flushPending.exchange(true))
+        PostToSocketThread(std::bind(&WorldSocket::HandleFlush, shared_from_this()));
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket& recvPacket)
@@ -617,6 +651,7 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<AuthSession> authSes
     //    sScriptMgr->OnAccountLogin(account.Id);
 
     _authed = true;
+    _accountId = account.Id;
     _worldSession = new WorldSession(account.Id, ClientBuild(authSession->Build), std::move(authSession->Account), shared_from_this(), account.Security,
         account.Expansion, mutetime, account.Locale, account.Recruiter, account.IsRectuiter);
     _worldSession->ReadAddonsInfo(authSession->AddonInfo);
@@ -73,6 +73,11 @@ protected:
 private:
     void CheckIpCallback(PreparedQueryResult result);
 
+    /// network thread only. Moves packets from _bufferQueue to socket write queue
+    void WriteQueuedPackets();
+    /// network thread only. Posted by SendPacket when _bufferQueue gets its first packet since last flush
+    void HandleFlush();
+
     /// writes network.opcode log
     /// accessing WorldSession is not threadsafe, only do it when holding _worldSessionLock
     void LogOpcodeText(OpcodeClient opcode, std::unique_lock<std::mutex> const& guard) const;
@@ -100,6 +105,8 @@ private:
     MessageBuffer _packetBuffer;
     MPSCQueue<EncryptablePacket> _bufferQueue;
     std::size_t _sendBufferSize;
+    std::atomic<bool> _flushPending;
+    std::atomic<uint32> _accountId; // 0 until authed, for packet log filtering
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
@@ -4,6 +4,7 @@
 
 #include "Define.h"
 #include "ObjectGuid.h"
+#include "SpellDefines.h"
 class Item;
 class SpellInfo;
 class Unit;
@@ -654,7 +654,10 @@ void AuraEffect::ChangeAmount(int32 newAmount, bool mark, bool onStackOrReapply)
     // Reapply if amount change
     uint8 handleMask = 0;
     if (newAmount != GetAmount())
+    {
         handleMask |= AURA_EFFECT_HANDLE_CHANGE_AMOUNT;
+        GetBase()->SetNeedSaveForOwner();
+    }
     if (onStackOrReapply)
         handleMask |= AURA_EFFECT_HANDLE_REAPPLY;
 
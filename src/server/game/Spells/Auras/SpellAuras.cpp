@@ -1564,6 +1564,7 @@ void Aura::SetDuration(int32 duration, bool withMods)
 
     m_duration = duration;
     SetNeedClientUpdateForTargets();
+    SetNeedSaveForOwner();
 }
 
 /*static*/ int32 Aura::CalcMaxDuration(SpellInfo const* spellInfo, WorldObject* caster)
@@ -1634,6 +1635,7 @@ void Aura::SetCharges(uint8 charges)
     m_procCharges = charges;
     m_isUsingCharges = m_procCharges != 0;
     SetNeedClientUpdateForTargets();
+    SetNeedSaveForOwner();
 }
 
 void Aura::ModChargesDelayed(int32 num, AuraRemoveMode removeMode)
@@ -1678,6 +1680,7 @@ void Aura::SetStackAmount(int32 amount)
             HandleAuraSpecificMods(aurApp, caster, true, true);
 
     SetNeedClientUpdateForTargets();
+    SetNeedSaveForOwner();
 }
 
 bool Aura::ModStackAmount(int32 num, AuraRemoveMode removeMode /*= AURA_REMOVE_BY_DEFAULT*/, bool resetPeriodicTimer /*= true*/)
@@ -3066,6 +3069,12 @@ void Aura::SetNeedClientUpdateForTargets() const
         appIter->second->SetNeedClientUpdate();
 }
 
+void Aura::SetNeedSaveForOwner() const
+{
+    if (Player* player = m_owner->ToPlayer())
+        player->SetSaveDirty(PLAYER_SAVE_DIRTY_AURAS);
+}
+
 void Aura::RecalculateAmountOfEffects()
 {
     ASSERT(!IsRemoved());
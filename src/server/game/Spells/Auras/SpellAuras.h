@@ -230,6 +230,8 @@ public:
     bool IsAppliedOnTarget(ObjectGuid guid) const { return m_applications.find(guid) != m_applications.end(); }
 
     void SetNeedClientUpdateForTargets() const;
+    // mark owner auras as changed for next player save
+    void SetNeedSaveForOwner() const;
     void HandleAuraSpecificMods(AuraApplication const* aurApp, Unit* caster, bool apply, bool onReapply);
     bool CanBeAppliedOn(Unit* target);
     bool CheckAreaTarget(Unit* target);
@@ -116,8 +116,13 @@ void SpellHistory::LoadFromDB(PreparedQueryResult cooldownsResult)
 }
 
 template<class OwnerType>
-void SpellHistory::SaveToDB(SQLTransaction& trans)
+void SpellHistory::SaveToDB(SQLTransaction& trans, bool force /*= false*/)
 {
+    if (!_needSave && !force)
+        return;
+
+    _needSave = false;
+
     typedef PersistenceHelper<OwnerType> StatementInfo;
 
     uint8 index = 0;
@@ -414,6 +419,8 @@ void SpellHistory::AddCooldown(uint32 spellId, uint32 itemId, Clock::time_point
 
     if (categoryId)
         _categoryCooldowns[categoryId] = &cooldownEntry;
+
+    _needSave = true;
 }
 
 #ifdef LICH_KING
@@ -426,7 +433,10 @@ void SpellHistory::ModifyCooldown(uint32 spellId, int32 cooldownModMs)
     Clock::time_point now = GameTime::GetGameTimeSystemPoint();
     Clock::duration offset = std::chrono::duration_cast<Clock::duration>(std::chrono::milliseconds(cooldownModMs));
     if (itr->second.CooldownEnd + offset > now)
+    {
         itr->second.CooldownEnd += offset;
+        _needSave = true;
+    }
     else
         EraseCooldown(itr);
 
@@ -486,6 +496,7 @@ void SpellHistory::ResetAllCooldowns()
     _categoryCooldowns.clear();
     _spellCooldowns.clear();
     _globalCooldowns.clear(); //sun: also reset global cooldowns
+    _needSave = true;
 }
 
 bool SpellHistory::HasCooldown(SpellInfo const* spellInfo, uint32 itemId /*= 0*/, bool ignoreCategoryCooldown /*= false*/) const
@@ -724,6 +735,7 @@ void SpellHistory::RestoreCooldownStateAfterDuel()
             if (!itr->second.OnHold && !_spellCooldowns[itr->first].OnHold)
                 _spellCooldowns[itr->first] = _spellCooldownsBeforeDuel[itr->first];
         }
+        _needSave = true;
 
         // update the client: restore old cooldowns
         PacketCooldowns cooldowns;
@@ -748,5 +760,5 @@ void SpellHistory::RestoreCooldownStateAfterDuel()
 
 template void SpellHistory::LoadFromDB<Player>(PreparedQueryResult cooldownsResult);
 template void SpellHistory::LoadFromDB<Pet>(PreparedQueryResult cooldownsResult);
-template void SpellHistory::SaveToDB<Player>(SQLTransaction& trans);
-template void SpellHistory::SaveToDB<Pet>(SQLTransaction& trans);
+template void SpellHistory::SaveToDB<Player>(SQLTransaction& trans, bool force);
+template void SpellHistory::SaveToDB<Pet>(SQLTransaction& trans, bool force);
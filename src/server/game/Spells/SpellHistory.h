@@ -60,13 +60,14 @@ public:
     typedef std::unordered_map<uint32 /*categoryId*/, CooldownEntry*> CategoryCooldownStorageType;
     typedef std::unordered_map<uint32 /*categoryId*/, Clock::time_point> GlobalCooldownStorageType;
 
-    explicit SpellHistory(Unit* owner) : _owner(owner), _schoolLockouts() { }
+    explicit SpellHistory(Unit* owner) : _owner(owner), _schoolLockouts(), _needSave(false) { }
 
     template<class OwnerType>
     void LoadFromDB(PreparedQueryResult cooldownsResult);
 
+    //only write cooldowns if they changed since last save, unless forced
     template<class OwnerType>
-    void SaveToDB(SQLTransaction& trans);
+    void SaveToDB(SQLTransaction& trans, bool force = false);
 
     void Update();
 
@@ -142,6 +143,7 @@ private:
     void SendClearCooldowns(std::vector<int32> const& cooldowns) const;
     CooldownStorageType::iterator EraseCooldown(CooldownStorageType::iterator itr)
     {
+        _needSave = true;
         _categoryCooldowns.erase(itr->second.CategoryId);
         return _spellCooldowns.erase(itr);
     }
@@ -157,6 +159,7 @@ private:
     CategoryCooldownStorageType _categoryCooldowns;
     Clock::time_point _schoolLockouts[MAX_SPELL_SCHOOL];
     GlobalCooldownStorageType _globalCooldowns;
+    bool _needSave; // cooldowns changed since last load or save
 
     template<class T>
     struct PersistenceHelper { };
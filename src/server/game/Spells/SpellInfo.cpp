@@ -756,6 +756,7 @@ SpellInfo::SpellInfo(SpellEntry const* spellEntry)
     ExplicitTargetMask = _GetExplicitTargetMask();
 
     _allowedMechanicMask = 0;
+    _hotData = nullptr;
 }
 
 
@@ -1509,6 +1510,9 @@ SpellInfo::~SpellInfo()
 // checks if spell targets are selected from area, doesn't include spell effects in check (like area wide auras for example)
 bool SpellInfo::IsTargetingArea() const
 {
+    if (_hotData)
+        return _hotData->TargetingAreaEffectMask != 0;
+
     for (const auto & Effect : Effects)
         if (Effect.IsEffect() && Effect.IsTargetingArea())
             return true;
@@ -1517,6 +1521,9 @@ bool SpellInfo::IsTargetingArea() const
 
 bool SpellInfo::IsAffectingArea() const
 {
+    if (_hotData)
+        return _hotData->AffectingAreaEffectMask != 0;
+
     for (const auto & Effect : Effects)
         if (Effect.IsEffect() && (Effect.IsTargetingArea() || Effect.IsEffect(SPELL_EFFECT_PERSISTENT_AREA_AURA) || Effect.IsAreaAuraEffect()))
             return true;
@@ -1568,6 +1575,9 @@ bool SpellInfo::CanBeUsedInCombat() const
 
 bool SpellInfo::HasAreaAuraEffect() const
 {
+    if (_hotData)
+        return _hotData->AreaAuraEffectMask != 0;
+
     for (const auto & Effect : Effects)
         if (Effect.IsAreaAuraEffect())
             return true;
@@ -1576,6 +1586,9 @@ bool SpellInfo::HasAreaAuraEffect() const
 
 bool SpellInfo::HasAnyAura() const
 {
+    if (_hotData)
+        return _hotData->AuraEffectMask != 0;
+
     for (const auto & Effect : Effects)
         if (Effect.IsAura())
             return true;
@@ -1614,6 +1627,9 @@ uint32 SpellInfo::GetCategory() const
 
 bool SpellInfo::HasEffect(SpellEffects effect) const
 {
+    if (_hotData)
+        return effect < TOTAL_SPELL_EFFECTS && _hotData->EffectTypes[effect];
+
     return HasEffectByEffectMask(effect, SPELL_EFFECT_MASK_ALL);
 }
 
@@ -1637,6 +1653,9 @@ bool SpellInfo::HasEffectByEffectMask(SpellEffects effect, SpellEffectMask effec
 
 bool SpellInfo::HasAura(AuraType aura) const
 {
+    if (_hotData)
+        return aura < TOTAL_AURAS && _hotData->AuraTypes[aura];
+
     for (const auto & Effect : Effects)
         if (Effect.IsAura(aura))
             return true;
@@ -1645,6 +1664,9 @@ bool SpellInfo::HasAura(AuraType aura) const
 
 bool SpellInfo::HasAuraEffect(AuraType aura) const
 {
+    if (_hotData)
+        return aura < TOTAL_AURAS && _hotData->AuraTypes[aura];
+
     for (const auto & Effect : Effects)
         if (Effect.IsAura(aura))
             return true;
@@ -1957,6 +1979,9 @@ SpellSchoolMask SpellInfo::GetSchoolMask() const
 
 uint32 SpellInfo::GetAllEffectsMechanicMask() const
 {
+    if (_hotData)
+        return _hotData->AllEffectsMechanicMask;
+
     uint32 mask = 0;
     if (Mechanic)
         mask |= 1 << Mechanic;
@@ -2006,6 +2031,10 @@ bool SpellInfo::HasAnyEffectMechanic() const
 
 float SpellInfo::GetMinRange(bool positive /*= false*/) const
 {
+#ifndef LICH_KING
+    if (_hotData)
+        return _hotData->MinRange;
+#endif
     if (!RangeEntry)
         return 0.0f;
 #ifdef LICH_KING
@@ -2021,14 +2050,22 @@ float SpellInfo::GetMaxRange(bool positive /*= false*/, WorldObject* caster /*=
 {
     if (!RangeEntry)
         return 0.0f;
+
     float range;
-#ifdef LICH_KING
-    if (positive)
-        range = RangeEntry->maxRangeFriend;
+#ifndef LICH_KING
+    if (_hotData)
+        range = _hotData->MaxRange;
     else
-        range = RangeEntry->maxRangeHostile;
 #endif
-    range = RangeEntry->maxRange;
+    {
+#ifdef LICH_KING
+        if (positive)
+            range = RangeEntry->maxRangeFriend;
+        else
+            range = RangeEntry->maxRangeHostile;
+#endif
+        range = RangeEntry->maxRange;
+    }
     if (caster)
         if (Player* modOwner = caster->GetSpellModOwner())
             modOwner->ApplySpellMod(Id, SPELLMOD_RANGE, range, spell);
@@ -2099,8 +2136,12 @@ bool SpellInfo::IsPositive(bool hostileTarget /* = false*/) const
     bool positive = !HasAttribute(SPELL_ATTR0_CU_NEGATIVE);
     //sun: dispel case: make it negative on hostile targets
     if (positive && hostileTarget)
-        if (HasEffect(SPELL_EFFECT_DISPEL) || HasEffect(SPELL_EFFECT_DISPEL_MECHANIC))
+    {
+        if (_hotData)
+            positive = _hotData->DispelEffectMask == 0;
+        else if (HasEffect(SPELL_EFFECT_DISPEL) || HasEffect(SPELL_EFFECT_DISPEL_MECHANIC))
             positive = false;
+    }
 
     return positive;
 }
@@ -2124,8 +2165,12 @@ bool SpellInfo::IsPositiveEffect(uint8 effIndex, bool hostileTarget /* = false *
 
     //sun: dispel case: make it negative on hostile targets
     if (hostileTarget && positive)
-        if (HasEffect(SPELL_EFFECT_DISPEL, effIndex) || HasEffect(SPELL_EFFECT_DISPEL_MECHANIC, effIndex))
+    {
+        if (_hotData)
+            return !(_hotData->DispelEffectMask & (1 << effIndex));
+        else if (HasEffect(SPELL_EFFECT_DISPEL, effIndex) || HasEffect(SPELL_EFFECT_DISPEL_MECHANIC, effIndex))
             return false;
+    }
 
     return positive;
 }
@@ -3408,6 +3453,48 @@ void SpellInfo::_InitializeSpellPositivity()
     }
 }
 
+void SpellInfo::_LoadHotData(SpellInfoHotData& hotData)
+{
+    // make sure we compute everything from effects and not from previous hot data (reload case)
+    _hotData = nullptr;
+    hotData = SpellInfoHotData();
+
+    for (uint8 i = 0; i < MAX_SPELL_EFFECTS; ++i)
+    {
+        SpellEffectInfo const& effect = Effects[i];
+        if (effect.Effect < TOTAL_SPELL_EFFECTS)
+            hotData.EffectTypes.set(effect.Effect);
+
+        if (effect.IsAura())
+        {
+            hotData.AuraEffectMask |= 1 << i;
+            if (effect.ApplyAuraName < TOTAL_AURAS)
+                hotData.AuraTypes.set(effect.ApplyAuraName);
+        }
+
+        if (effect.IsAreaAuraEffect())
+            hotData.AreaAuraEffectMask |= 1 << i;
+
+        if (!effect.IsEffect())
+            continue;
+
+        if (effect.IsTargetingArea())
+            hotData.TargetingAreaEffectMask |= 1 << i;
+
+        if (effect.IsTargetingArea() || effect.IsEffect(SPELL_EFFECT_PERSISTENT_AREA_AURA) || effect.IsAreaAuraEffect())
+            hotData.AffectingAreaEffectMask |= 1 << i;
+
+        if (effect.IsEffect(SPELL_EFFECT_DISPEL) || effect.IsEffect(SPELL_EFFECT_DISPEL_MECHANIC))
+            hotData.DispelEffectMask |= 1 << i;
+    }
+
+    hotData.AllEffectsMechanicMask = GetAllEffectsMechanicMask();
+    hotData.MinRange = GetMinRange();
+    hotData.MaxRange = GetMaxRange();
+
+    _hotData = &hotData;
+}
+
 void SpellInfo::_UnloadImplicitTargetConditionLists()
 {
     // find the same instances of ConditionContainer and delete them.
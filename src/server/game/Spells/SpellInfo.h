@@ -3,8 +3,10 @@
 
 #include "SharedDefines.h"
 #include "DBCStructure.h"
+#include "SpellAuraDefines.h"
 
 #include <boost/container/flat_set.hpp>
+#include <bitset>
 
 enum AuraType : unsigned int;
 enum SpellCastResult : int;
@@ -351,6 +353,23 @@ struct TC_GAME_API ImmunityInfo
     boost::container::flat_set<SpellEffects> SpellEffectImmune;
 };
 
+// Values derived from effects and attributes, precomputed once all SpellInfo alterations are loaded (see SpellMgr::LoadSpellInfoHotData).
+// Stored contiguously by SpellMgr and indexed by spell id, SpellInfo accessors use them instead of walking Effects when available.
+struct TC_GAME_API SpellInfoHotData
+{
+    std::bitset<TOTAL_SPELL_EFFECTS> EffectTypes;
+    std::bitset<TOTAL_AURAS> AuraTypes;
+    uint32 AllEffectsMechanicMask = 0;
+    float MinRange = 0.0f;
+    float MaxRange = 0.0f;
+    // effect index masks
+    uint8 AuraEffectMask = 0;
+    uint8 AreaAuraEffectMask = 0;
+    uint8 TargetingAreaEffectMask = 0;
+    uint8 AffectingAreaEffectMask = 0;
+    uint8 DispelEffectMask = 0; // SPELL_EFFECT_DISPEL or SPELL_EFFECT_DISPEL_MECHANIC, negative on hostile targets
+};
+
 class TC_GAME_API SpellInfo
 {
     friend class SpellMgr;
@@ -601,6 +620,7 @@ private:
     uint32 _GetExplicitTargetMask() const;
 
     void _InitializeSpellPositivity();
+    void _LoadHotData(SpellInfoHotData& hotData);
 
     // unloading helpers
     void _UnloadImplicitTargetConditionLists();
@@ -611,6 +631,9 @@ private:
     uint32 _allowedMechanicMask;
 
     ImmunityInfo _immunityInfo[MAX_SPELL_EFFECTS];
+
+    //can be null until SpellMgr::LoadSpellInfoHotData was called
+    SpellInfoHotData const* _hotData;
 };
 
 #endif // _SPELLINFO_
\ No newline at end of file
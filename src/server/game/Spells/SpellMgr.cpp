@@ -2895,6 +2895,7 @@ void SpellMgr::UnloadSpellInfoStore()
         delete mSpellInfoMap[i];
 
     mSpellInfoMap.clear();
+    mSpellInfoHotData.clear();
 }
 
 void SpellMgr::UnloadSpellInfoImplicitTargetConditionLists()
@@ -3743,6 +3744,29 @@ void SpellMgr::LoadSpellInfoDiminishing()
     TC_LOG_INFO("server.loading", ">> Loaded SpellInfo diminishing infos in %u ms", GetMSTimeDiffToNow(oldMSTime));
 }
 
+void SpellMgr::LoadSpellInfoHotData()
+{
+    uint32 oldMSTime = GetMSTime();
+
+    // SpellInfo keep pointers into this container, only resize it if needed (reload case)
+    if (mSpellInfoHotData.size() != mSpellInfoMap.size())
+    {
+        for (SpellInfo* spellInfo : mSpellInfoMap)
+            if (spellInfo)
+                spellInfo->_hotData = nullptr;
+
+        mSpellInfoHotData.assign(mSpellInfoMap.size(), SpellInfoHotData());
+    }
+
+    for (uint32 i = 0; i < mSpellInfoMap.size(); ++i)
+    {
+        if (SpellInfo* spellInfo = mSpellInfoMap[i])
+            spellInfo->_LoadHotData(mSpellInfoHotData[i]);
+    }
+
+    TC_LOG_INFO("server.loading", ">> Loaded SpellInfo hot data in %u ms", GetMSTimeDiffToNow(oldMSTime));
+}
+
 SpellInfo const* SpellMgr::EnsureSpellInfo(uint32 spellId) const
 {
     ASSERT(spellId < GetSpellInfoStoreSize());
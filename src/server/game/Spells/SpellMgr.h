@@ -842,6 +842,7 @@ typedef std::multimap<uint32, SkillLineAbilityEntry const*> SkillLineAbilityMap;
 typedef std::pair<SkillLineAbilityMap::const_iterator, SkillLineAbilityMap::const_iterator> SkillLineAbilityMapBounds;
 
 typedef std::vector<SpellInfo*> SpellInfoMap;
+typedef std::vector<SpellInfoHotData> SpellInfoHotDataMap;
 
 typedef std::unordered_map<int32, std::vector<int32> > SpellLinkedMap;
 
@@ -1039,6 +1040,8 @@ class TC_GAME_API SpellMgr
         void LoadSpellAreas();
         void LoadSpellInfoImmunities();
         void LoadSpellInfoDiminishing();
+        //must be called after any SpellInfo effect alteration
+        void LoadSpellInfoHotData();
 
         // SpellInfo object management
         SpellInfo const* GetSpellInfo(uint32 spellId) const { return spellId < GetSpellInfoStoreSize() ? mSpellInfoMap[spellId] : nullptr; }
@@ -1084,6 +1087,7 @@ class TC_GAME_API SpellMgr
         SpellAreaForQuestAreaMap   mSpellAreaForQuestAreaMap;
 
         SpellInfoMap               mSpellInfoMap;
+        SpellInfoHotDataMap        mSpellInfoHotData;
 };
 
 #define sSpellMgr SpellMgr::instance()
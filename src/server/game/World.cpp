@@ -27,6 +27,7 @@
 #include "ItemEnchantmentMgr.h"
 #include "Language.h"
 #include "Monitor.h"
+#include "Profiler.h"
 #include "Log.h"
 #include "LogsDatabaseAccessor.h"
 #include "LootMgr.h"
@@ -43,6 +44,7 @@
 #include "OutdoorPvPMgr.h"
 #include "PetitionMgr.h"
 #include "Player.h"
+#include "PlayerSaveQueue.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "QueryCallback.h"
@@ -606,9 +608,18 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading","Compression level (%i) must be in range 1..9. Using default compression level (1).",m_configs[CONFIG_COMPRESSION]);
         m_configs[CONFIG_COMPRESSION] = 1;
     }
+    m_configs[CONFIG_BATCH_MOVEMENT_PACKETS] = sConfigMgr->GetBoolDefault("Compression.BatchMovementPackets", false);
     m_configs[CONFIG_ADDON_CHANNEL] = sConfigMgr->GetBoolDefault("AddonChannel", true);
     m_configs[CONFIG_GRID_UNLOAD] = sConfigMgr->GetBoolDefault("GridUnload", true);
     m_configs[CONFIG_INTERVAL_SAVE] = sConfigMgr->GetIntDefault("PlayerSaveInterval", 60000);
+    m_configs[CONFIG_PLAYER_SAVE_FULL_EVERY] = sConfigMgr->GetIntDefault("PlayerSave.FullSaveEvery", 10);
+    m_configs[CONFIG_PLAYER_SAVE_QUEUE_MAX_PER_UPDATE] = sConfigMgr->GetIntDefault("PlayerSave.Queue.MaxPerUpdate", 50);
+    if (m_configs[CONFIG_PLAYER_SAVE_QUEUE_MAX_PER_UPDATE] == 0)
+    {
+        TC_LOG_ERROR("server.loading", "PlayerSave.Queue.MaxPerUpdate (%u) must be > 0. Using 1 instead.", m_configs[CONFIG_PLAYER_SAVE_QUEUE_MAX_PER_UPDATE]);
+        m_configs[CONFIG_PLAYER_SAVE_QUEUE_MAX_PER_UPDATE] = 1;
+    }
+    m_configs[CONFIG_PLAYER_SAVE_QUEUE_BACKPRESSURE] = sConfigMgr->GetIntDefault("PlayerSave.Queue.Backpressure", 1000);
     m_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = sConfigMgr->GetIntDefault("DisconnectToleranceInterval", 0);
 
     m_configs[CONFIG_INTERVAL_MAPUPDATE] = sConfigMgr->GetIntDefault("MapUpdateInterval", 100);
@@ -910,6 +921,7 @@ void World::LoadConfigSettings(bool reload)
     m_configs[CONFIG_LOG_SANCTIONS] = sConfigMgr->GetIntDefault("DBLog.sanctions", -1);
     m_configs[CONFIG_LOG_CONNECTION_IP] = sConfigMgr->GetIntDefault("DBLog.connectionip",-1);
     m_configs[CONFIG_GM_LOG_CONNECTION_IP] = sConfigMgr->GetIntDefault("DBLog.gm.connectionip", -1);
+    m_configs[CONFIG_LOGS_BATCH_INTERVAL] = sConfigMgr->GetIntDefault("DBLog.BatchInterval", 1000);
 
     m_configs[CONFIG_MAIL_DELIVERY_DELAY] = sConfigMgr->GetIntDefault("MailDeliveryDelay",HOUR);
 
@@ -997,6 +1009,7 @@ void World::LoadConfigSettings(bool reload)
     m_configs[CONFIG_CREATURE_UNREACHABLE_TARGET_EVADE_TIME] = sConfigMgr->GetIntDefault("CreatureUnreachableTarget.EvadeHomeTimer", 10000);
     m_configs[CONFIG_CREATURE_UNREACHABLE_TARGET_EVADE_ATTACKS_TIME] = sConfigMgr->GetIntDefault("CreatureUnreachableTarget.EvadeAttacksTimer", 3000);
     m_configs[CONFIG_CREATURE_STOP_FOR_PLAYER] = sConfigMgr->GetIntDefault("Creature.MovingStopTimeForPlayer", 1 * MINUTE * IN_MILLISECONDS);
+    m_configs[CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL] = sConfigMgr->GetIntDefault("Creature.DormantUpdateInterval", 0);
     // note: disable value (-1) will assigned as 0xFFFFFFF, to prevent overflow at calculations limit it to max possible player level MAX_LEVEL(100)
     m_configs[CONFIG_QUEST_LOW_LEVEL_HIDE_DIFF] = sConfigMgr->GetIntDefault("Quests.LowLevelHideDiff", 4);
     if(m_configs[CONFIG_QUEST_LOW_LEVEL_HIDE_DIFF] > MAX_LEVEL)
@@ -1107,6 +1120,8 @@ void World::LoadConfigSettings(bool reload)
     m_configs[CONFIG_INSTANT_LOGOUT] = sConfigMgr->GetIntDefault("InstantLogout", SEC_GAMEMASTER1);
 
     m_configs[CONFIG_GROUPLEADER_RECONNECT_PERIOD] = sConfigMgr->GetIntDefault("GroupLeaderReconnectPeriod", 180);
+    m_configs[CONFIG_GROUP_MEMBER_STATS_INTERVAL] = sConfigMgr->GetIntDefault("Group.MemberStats.Interval", 0);
+    m_configs[CONFIG_GROUP_MEMBER_POSITION_INTERVAL] = sConfigMgr->GetIntDefault("Group.MemberStats.PositionInterval", 1000);
 
     //visibility on continents
     m_MaxVisibleDistanceOnContinents      = sConfigMgr->GetFloatDefault("Visibility.Distance.Continents",     DEFAULT_VISIBILITY_DISTANCE);
@@ -1249,6 +1264,12 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading", "Monitor.DynamicViewDist.AverageCount must be greater than 0. Setting it to default value (500)");
         m_configs[CONFIG_MONITORING_DYNAMIC_VIEWDIST_AVERAGE_COUNT] = 500;
     }
+    m_configs[CONFIG_MONITORING_OPCODE_COSTS] = sConfigMgr->GetBoolDefault("Monitor.OpcodeCosts.Enable", false);
+    m_configs[CONFIG_MONITORING_OPCODE_COSTS_LOG_INTERVAL] = sConfigMgr->GetIntDefault("Monitor.OpcodeCosts.LogInterval", 300);
+    m_configs[CONFIG_MONITORING_PACKET_SEND_LATENCY] = sConfigMgr->GetBoolDefault("Monitor.PacketSendLatency.Enable", false);
+
+    m_configs[CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP] = sConfigMgr->GetBoolDefault("Profiler.Zones.SlowTickDump", false);
+    m_configs[CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP_COOLDOWN] = sConfigMgr->GetIntDefault("Profiler.Zones.SlowTickDump.Cooldown", 600);
 
 
     std::string forbiddenmaps = sConfigMgr->GetStringDefault("ForbiddenMaps", "");
@@ -1663,6 +1684,9 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Loading SpellInfo immunity infos...");
     sSpellMgr->LoadSpellInfoImmunities();
 
+    TC_LOG_INFO("server.loading", "Loading SpellInfo hot data...");
+    sSpellMgr->LoadSpellInfoHotData(); //must be after all SpellInfo alterations
+
     TC_LOG_INFO("server.loading", "Loading Quests..." );
     sObjectMgr->LoadQuests();                                    // must be loaded after DBCs, creature_template, item_template, gameobject tables
 
@@ -2039,6 +2063,7 @@ void World::Update(time_t diff)
     time_t currentGameTime = WorldGameTime::GetGameTime();
 
     sMonitor->StartedWorldLoop();
+    sProfiler->WorldTickStarted();
 
     sWorldUpdateTime.UpdateWithDiff(diff);
 
@@ -2101,7 +2126,10 @@ void World::Update(time_t diff)
 
     /// <li> Handle session updates
     sWorldUpdateTime.RecordUpdateTimeReset();
-    UpdateSessions(diff);
+    {
+        PROFILE_ZONE("World::UpdateSessions");
+        UpdateSessions(diff);
+    }
     sWorldUpdateTime.RecordUpdateTimeDuration("UpdateSessions");
 
     // Update groups
@@ -2147,9 +2175,26 @@ void World::Update(time_t diff)
 
     ///- Update objects (maps, transport, creatures,...)
     sWorldUpdateTime.RecordUpdateTimeReset();
-    sMapMgr->Update(diff);
+    {
+        PROFILE_ZONE("MapManager::Update");
+        sMapMgr->Update(diff);
+    }
     sWorldUpdateTime.RecordUpdateTimeDuration("UpdateMapMgr");
 
+    ///- Save players whose autosave timer expired during map updates
+    sWorldUpdateTime.RecordUpdateTimeReset();
+    {
+        PROFILE_ZONE("PlayerSaveQueue::Update");
+        sPlayerSaveQueue->Update();
+    }
+    sWorldUpdateTime.RecordUpdateTimeDuration("UpdatePlayerSaveQueue");
+
+    ///- Execute logs database statements queued by map threads
+    {
+        PROFILE_ZONE("LogsDatabaseAccessor::Update");
+        sLogsDatabaseAccessor->Update(diff);
+    }
+
 #ifdef TESTS
     //MUST be after map updates, testing code assumes so
     sWorldUpdateTime.RecordUpdateTimeReset();
@@ -2183,7 +2228,10 @@ void World::Update(time_t diff)
 
     // execute callbacks from sql queries that were queued recently
     sWorldUpdateTime.RecordUpdateTimeReset();
-    ProcessQueryCallbacks();
+    {
+        PROFILE_ZONE("World::ProcessQueryCallbacks");
+        ProcessQueryCallbacks();
+    }
     sWorldUpdateTime.RecordUpdateTimeDuration("ProcessQueryCallbacks");
 
     ///- Announce if a timer has passed
@@ -2240,6 +2288,7 @@ void World::Update(time_t diff)
 
     sMonitor->FinishedWorldLoop();
     sMonitor->Update(diff);
+    sProfiler->WorldTickEnded();
 
 #ifdef TESTS
     if (_CITesting)
@@ -82,8 +82,12 @@ enum WorldTimers
 enum WorldConfigs
 {
     CONFIG_COMPRESSION = 0,
+    CONFIG_BATCH_MOVEMENT_PACKETS,
     CONFIG_GRID_UNLOAD,
     CONFIG_INTERVAL_SAVE,
+    CONFIG_PLAYER_SAVE_FULL_EVERY,
+    CONFIG_PLAYER_SAVE_QUEUE_MAX_PER_UPDATE,
+    CONFIG_PLAYER_SAVE_QUEUE_BACKPRESSURE,
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
@@ -175,6 +179,7 @@ enum WorldConfigs
     //creature unreachable for this time start evading all attacks
     CONFIG_CREATURE_UNREACHABLE_TARGET_EVADE_ATTACKS_TIME,
     CONFIG_CREATURE_STOP_FOR_PLAYER,
+    CONFIG_CREATURE_DORMANT_UPDATE_INTERVAL,
     CONFIG_QUEST_LOW_LEVEL_HIDE_DIFF,
     CONFIG_QUEST_HIGH_LEVEL_HIDE_DIFF,
     CONFIG_RESTRICTED_LFG_CHANNEL,
@@ -212,6 +217,8 @@ enum WorldConfigs
     CONFIG_THREAT_RADIUS,
     CONFIG_INSTANT_LOGOUT,
     CONFIG_GROUPLEADER_RECONNECT_PERIOD,
+    CONFIG_GROUP_MEMBER_STATS_INTERVAL,
+    CONFIG_GROUP_MEMBER_POSITION_INTERVAL,
     CONFIG_ALL_TAXI_PATHS,
     CONFIG_INSTANT_TAXI,
     CONFIG_DECLINED_NAMES_USED,
@@ -278,6 +285,7 @@ enum WorldConfigs
     CONFIG_LOG_SANCTIONS,
     CONFIG_LOG_CONNECTION_IP,
     CONFIG_GM_LOG_CONNECTION_IP,
+    CONFIG_LOGS_BATCH_INTERVAL,
 
     CONFIG_MYSQL_BUNDLE_LOGINDB,
     CONFIG_MYSQL_BUNDLE_CHARDB,
@@ -372,6 +380,12 @@ enum WorldConfigs
     CONFIG_MONITORING_DYNAMIC_VIEWDIST_AVERAGE_COUNT,
 
 	CONFIG_MONITORING_LAG_AUTO_REBOOT_COUNT,
+    CONFIG_MONITORING_OPCODE_COSTS,
+    CONFIG_MONITORING_OPCODE_COSTS_LOG_INTERVAL,
+    CONFIG_MONITORING_PACKET_SEND_LATENCY,
+
+    CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP,
+    CONFIG_PROFILER_ZONES_SLOW_TICK_DUMP_COOLDOWN,
 
     CONFIG_HOTSWAP_ENABLED,
     CONFIG_HOTSWAP_RECOMPILER_ENABLED,
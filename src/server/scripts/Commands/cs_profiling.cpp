@@ -13,6 +13,7 @@ public:
             { "start",     SEC_SUPERADMIN,   true,  &HandleProfilingStartCommand,             "" },
             { "stop",      SEC_SUPERADMIN,   true,  &HandleProfilingStopCommand,              "" },
             { "status",    SEC_SUPERADMIN,   true,  &HandleProfilingStatusCommand,            "" },
+            { "zones",     SEC_SUPERADMIN,   true,  &HandleProfilingZonesCommand,             "" },
         };
         static std::vector<ChatCommand> commandTable =
         {
@@ -55,6 +56,33 @@ public:
     {
         std::string infos = sProfiler->GetInfos();
         handler->PSendSysMessage("Profiling infos:\n%s", infos.c_str());
+        std::string zoneInfos = sProfiler->GetZoneInfos();
+        handler->PSendSysMessage("%s", zoneInfos.c_str());
+        return true;
+    }
+
+    /* .profiling zones <ticks> [filename]
+    Record profiling zones for the next <ticks> world updates and write them as a Chrome trace */
+    static bool HandleProfilingZonesCommand(ChatHandler* handler, char const* args)
+    {
+        ARGS_CHECK
+
+        char* cTicks = strtok((char*)args, " ");
+        int32 ticks = atoi(cTicks);
+        if (ticks <= 0)
+            return false;
+
+        //default filename
+        std::string filename = std::to_string(time(nullptr)) + ".json";
+        char* cFileName = strtok(nullptr, " ");
+        if (cFileName)
+            filename = cFileName;
+
+        std::string failureReason;
+        if (sProfiler->StartZoneCapture(uint32(ticks), filename, failureReason))
+            handler->PSendSysMessage("Recording zones for %i world updates, writing to %s", ticks, filename.c_str());
+        else
+            handler->PSendSysMessage("Zone capture failed with reason %s", failureReason.c_str());
         return true;
     }
 };
@@ -848,6 +848,7 @@ public:
     {
         TC_LOG_INFO("command", "Re-Loading Locales Item ... ");
         sObjectMgr->LoadItemLocales();
+        sAuctionMgr->ClearItemSearchNames();
         handler->SendGlobalGMSysMessage("DB table `locales_item` reloaded.");
         return true;
     }
@@ -941,6 +942,7 @@ public:
         sSpellMgr->LoadSpellLinked();
         sSpellMgr->LoadSpellAffects();
         sSpellMgr->LoadSpellTalentRanks();
+        sSpellMgr->LoadSpellInfoHotData();
 
         handler->SendGlobalGMSysMessage("DB table `spell_template` (spell definitions) reloaded.");
         return true;
@@ -2,9 +2,13 @@
 #include "Language.h"
 #include "GlobalEvents.h"
 #include "Monitor.h"
+#include "Opcodes.h"
+#include "PlayerSaveQueue.h"
+#include "PacketLog.h"
 #include "GitRevision.h"
 #include "GameTime.h"
 #include <numeric>
+#include <iomanip>
 #include "VMapFactory.h"
 #include "Realm.h"
 #include "DatabaseLoader.h"
@@ -54,6 +58,11 @@ public:
             { "cancel",         SEC_ADMINISTRATOR,  true, &HandleServerShutDownCancelCommand, "" },
             { ""   ,            SEC_ADMINISTRATOR,  true, &HandleServerShutDownCommand,       "" },
         };
+        static std::vector<ChatCommand> serverOpcodesCommandTable =
+        {
+            { "reset",          SEC_ADMINISTRATOR,  true, &HandleServerOpcodesResetCommand,   "" },
+            { ""   ,            SEC_ADMINISTRATOR,  true, &HandleServerOpcodesCommand,        "" },
+        };
         static std::vector<ChatCommand> serverCommandTable =
         {
             { "corpses",        SEC_GAMEMASTER2,     true, &HandleServerCorpsesCommand,       "" },
@@ -63,6 +72,7 @@ public:
             { "idleshutdown",   SEC_ADMINISTRATOR,   true,  nullptr,                          "", serverShutdownCommandTable },
             { "info",           SEC_PLAYER,          true,  &HandleServerInfoCommand,         "" },
             { "motd",           SEC_PLAYER,          true,  &HandleServerMotdCommand,         "" },
+            { "opcodes",        SEC_ADMINISTRATOR,   true,  nullptr,                          "", serverOpcodesCommandTable },
             { "restart",        SEC_ADMINISTRATOR,   true,  nullptr,                          "", serverRestartCommandTable },
             { "shutdown",       SEC_ADMINISTRATOR,   true,  nullptr,                          "", serverShutdownCommandTable },
             { "set",            SEC_ADMINISTRATOR,   true,  nullptr,                          "", serverSetCommandTable },
@@ -240,6 +250,27 @@ public:
         handler->PSendSysMessage("Instant update time diff: %u.", sWorldUpdateTime.GetLastUpdateTime());
         if(currentMapTimeDiff != 0)
             handler->PSendSysMessage("Current map update time diff: %u.", currentMapTimeDiff);
+        PlayerSavesInfo const& saves = sMonitor->GetPlayerSavesInfo();
+        if (uint64 saveCount = saves.saves)
+            handler->PSendSysMessage("Player saves: " UI64FMTD " (full: " UI64FMTD "), rows per save: %.1f avg, %u max.", saveCount, uint64(saves.fullSaves), double(saves.rows) / saveCount, uint32(saves.maxRows));
+        handler->PSendSysMessage("Player save queue: %u pending (queued: " UI64FMTD ", coalesced: " UI64FMTD ", throttled updates: " UI64FMTD "), character db queue: %u.",
+            uint32(sPlayerSaveQueue->GetSize()), uint64(saves.queued), uint64(saves.coalesced), uint64(saves.throttledUpdates), uint32(CharacterDatabase.QueueSize()));
+        if (sPacketLog->CanLogPacket())
+            handler->PSendSysMessage("Packet log dropped packets: " UI64FMTD ".", sPacketLog->GetDroppedCount());
+        PacketSendLatencyInfo const& sendLatency = sMonitor->GetPacketSendLatencyInfo();
+        if (uint64 sentCount = sendLatency.count)
+        {
+            std::ostringstream buckets;
+            for (uint32 i = 0; i < PacketSendLatencyInfo::BUCKET_COUNT; ++i)
+            {
+                if (i < PacketSendLatencyInfo::BUCKET_COUNT - 1)
+                    buckets << " <" << PacketSendLatencyInfo::BucketLimits[i] / 1000 << "ms: ";
+                else
+                    buckets << " more: ";
+                buckets << std::fixed << std::setprecision(1) << 100.0 * sendLatency.buckets[i] / sentCount << "%";
+            }
+            handler->PSendSysMessage("Packet send delay: %u us avg,%s", uint32(sendLatency.totalLatency / sentCount), buckets.str().c_str());
+        }
         if (sWorld->IsShuttingDown())
             handler->PSendSysMessage("Server restart in %s", secsToTimeString(sWorld->GetShutDownTimeLeft()).c_str());
 
@@ -253,6 +284,43 @@ public:
         return true;
     }
 
+    /* .server opcodes [count]
+    List the most expensive client opcodes since startup or last reset, requires Monitor.OpcodeCosts.Enable */
+    static bool HandleServerOpcodesCommand(ChatHandler* handler, char const* args)
+    {
+        if (!sWorld->getConfig(CONFIG_MONITORING_OPCODE_COSTS))
+        {
+            handler->SendSysMessage("Opcode costs are not recorded, enable Monitor.OpcodeCosts.Enable first.");
+            return true;
+        }
+
+        uint32 count = 10;
+        if (*args)
+            count = std::max(1, atoi(args));
+
+        std::vector<OpcodeCostInfo> costs = sMonitor->GetOpcodeCosts();
+        if (costs.empty())
+        {
+            handler->SendSysMessage("No opcode handled yet.");
+            return true;
+        }
+
+        for (uint32 i = 0; i < costs.size() && i < count; ++i)
+        {
+            OpcodeCostInfo const& cost = costs[i];
+            handler->PSendSysMessage("%s: " UI64FMTD " packets, total " UI64FMTD " us, avg " UI64FMTD " ns, max " UI64FMTD " us, " UI64FMTD " bytes",
+                GetOpcodeNameForLogging(static_cast<OpcodeClient>(cost.opcode)).c_str(), cost.count, cost.totalTime / 1000, cost.totalTime / cost.count, cost.maxTime / 1000, cost.bytes);
+        }
+        return true;
+    }
+
+    static bool HandleServerOpcodesResetCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sMonitor->ResetOpcodeCosts();
+        handler->SendSysMessage("Opcode costs reset.");
+        return true;
+    }
+
     static bool HandleServerShutDownCancelCommand(ChatHandler* handler, char const* args)
     {
         sWorld->ShutdownCancel();
@@ -0,0 +1,145 @@
+#include "TestCase.h"
+#include "Containers.h"
+#include "Loot.h"
+#include "LootMgr.h"
+#include "Random.h"
+
+// "loot group roll"
+// Rolls a loot group through LootTemplate::Process and compares the drops with the copy and filter algorithm LootGroup::Roll used before
+class LootGroupRollTest : public TestCase
+{
+public:
+    static uint32 const DUPLICATE_ITEM = 2589; // Linen Cloth, already in the loot before rolling
+    static uint32 const OTHER_MODE_EXPLICIT_ITEM = 4338; // Mageweave Cloth
+    static uint32 const OTHER_MODE_EQUAL_ITEM = 8170; // Rugged Leather
+    static uint32 const REFERENCE_ROLLS = 200000;
+
+    // Adds an entry to group 1 of the template, and to the lists used by the reference roll. The template owns the entry.
+    void AddGroupEntry(LootTemplate& lootTemplate, uint32 itemId, float chance, uint16 lootMode)
+    {
+        LootStoreItem* item = new LootStoreItem(itemId, 0, chance, false, lootMode, 1, 1, 1);
+        lootTemplate.AddEntry(item);
+        if (chance != 0)
+            _explicitlyChanced.push_back(item);
+        else
+            _equalChanced.push_back(item);
+    }
+
+    static void PrepareLoot(Loot& loot)
+    {
+        loot.AddItem(LootStoreItem(DUPLICATE_ITEM, 0, 100.0f, false, LOOT_MODE_DEFAULT, 0, 1, 1));
+    }
+
+    // LootGroup::Roll before entries were filtered in place
+    LootStoreItem const* ReferenceRoll(Loot const& loot, uint16 lootMode) const
+    {
+        auto isInvalid = [&](LootStoreItem* item)
+        {
+            if (!(item->lootmode & lootMode))
+                return true;
+
+            uint8 foundDuplicates = 0;
+            for (LootItem const& lootItem : loot.items)
+                if (lootItem.itemid == item->itemid)
+                    if (++foundDuplicates == loot.maxDuplicates)
+                        return true;
+
+            return false;
+        };
+
+        LootStoreItemList possibleLoot = _explicitlyChanced;
+        possibleLoot.remove_if(isInvalid);
+        if (!possibleLoot.empty())
+        {
+            float roll = (float)rand_chance();
+            for (LootStoreItem* item : possibleLoot)
+            {
+                if (item->chance >= 100.0f)
+                    return item;
+
+                roll -= item->chance;
+                if (roll < 0)
+                    return item;
+            }
+        }
+
+        possibleLoot = _equalChanced;
+        possibleLoot.remove_if(isInvalid);
+        if (!possibleLoot.empty())
+            return Trinity::Containers::SelectRandomContainerElement(possibleLoot);
+
+        return nullptr;
+    }
+
+    void Test() override
+    {
+        // Invalid entries are placed between valid ones, so that skipping them must not shift the roll
+        LootTemplate lootTemplate;
+        AddGroupEntry(lootTemplate, 2592, 20.0f, LOOT_MODE_DEFAULT);                        // Wool Cloth
+        AddGroupEntry(lootTemplate, OTHER_MODE_EXPLICIT_ITEM, 30.0f, LOOT_MODE_HARD_MODE_1);
+        AddGroupEntry(lootTemplate, DUPLICATE_ITEM, 25.0f, LOOT_MODE_DEFAULT);
+        AddGroupEntry(lootTemplate, 4306, 15.0f, LOOT_MODE_DEFAULT);                        // Silk Cloth
+        AddGroupEntry(lootTemplate, 14047, 0.0f, LOOT_MODE_DEFAULT);                        // Runecloth
+        AddGroupEntry(lootTemplate, OTHER_MODE_EQUAL_ITEM, 0.0f, LOOT_MODE_HARD_MODE_1);
+        AddGroupEntry(lootTemplate, DUPLICATE_ITEM, 0.0f, LOOT_MODE_DEFAULT);
+        AddGroupEntry(lootTemplate, 21877, 0.0f, LOOT_MODE_DEFAULT);                        // Netherweave Cloth
+
+        SECTION("distribution", [&]() {
+            std::map<uint32 /*itemId, 0 if none*/, uint32 /*count*/> referenceDrops;
+            for (uint32 i = 0; i < REFERENCE_ROLLS; ++i)
+            {
+                Loot loot;
+                PrepareLoot(loot);
+                LootStoreItem const* item = ReferenceRoll(loot, LOOT_MODE_DEFAULT);
+                ++referenceDrops[item ? item->itemid : 0];
+            }
+
+            // sample size for the least likely drop
+            float minExpectedPercent = 100.0f;
+            for (auto const& itr : referenceDrops)
+                minExpectedPercent = std::min(minExpectedPercent, 100.0f * itr.second / REFERENCE_ROLLS);
+            uint32 const sampleSize = _GetPercentApproximationParams(minExpectedPercent).first;
+
+            std::map<uint32 /*itemId, 0 if none*/, uint32 /*count*/> drops;
+            for (uint32 i = 0; i < sampleSize; ++i)
+            {
+                Loot loot;
+                PrepareLoot(loot);
+                lootTemplate.Process(loot, false, LOOT_MODE_DEFAULT, 1);
+                TEST_ASSERT(loot.items.size() <= 2);
+                ++drops[loot.items.size() == 2 ? loot.items[1].itemid : 0];
+            }
+
+            // entries of another loot mode or over the duplicate limit never drop
+            for (uint32 itemId : { OTHER_MODE_EXPLICIT_ITEM, OTHER_MODE_EQUAL_ITEM, DUPLICATE_ITEM })
+            {
+                ASSERT_INFO("Item %u dropped", itemId);
+                TEST_ASSERT(referenceDrops.find(itemId) == referenceDrops.end() && drops.find(itemId) == drops.end());
+            }
+
+            for (auto const& itr : drops)
+            {
+                ASSERT_INFO("Item %u dropped but never did with the reference roll", itr.first);
+                TEST_ASSERT(referenceDrops.find(itr.first) != referenceDrops.end());
+            }
+
+            for (auto const& itr : referenceDrops)
+            {
+                float const expectedPercent = 100.0f * itr.second / REFERENCE_ROLLS;
+                float const tolerance = _GetPercentTestTolerance(expectedPercent);
+                float const actualPercent = 100.0f * drops[itr.first] / sampleSize;
+                ASSERT_INFO("Item %u: expected %f, result %f", itr.first, expectedPercent, actualPercent);
+                TEST_ASSERT(Between<float>(actualPercent, expectedPercent - tolerance, expectedPercent + tolerance));
+            }
+        });
+    }
+
+private:
+    LootStoreItemList _explicitlyChanced;
+    LootStoreItemList _equalChanced;
+};
+
+void AddSC_test_loot_group_roll()
+{
+    RegisterTestCase("loot group roll", LootGroupRollTest);
+}
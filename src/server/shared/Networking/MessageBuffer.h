@@ -42,6 +42,9 @@ public:
 
     MessageBuffer(MessageBuffer&& right) : _wpos(right._wpos), _rpos(right._rpos), _storage(right.Move()) { }
 
+    /// Takes over already written data, used to send packet storage without copying it
+    explicit MessageBuffer(std::vector<uint8>&& data) : _wpos(data.size()), _rpos(0), _storage(std::move(data)) { }
+
     void Reset()
     {
         _wpos = 0;
@@ -20,8 +20,9 @@
 
 #include "MessageBuffer.h"
 #include "Log.h"
+#include "IoContext.h"
 #include <atomic>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <functional>
 #include <type_traits>
@@ -30,6 +31,8 @@
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+// Max queued buffers written with a single gather write
+#define WRITE_GATHER_MAX_BUFFERS 64
 #ifdef BOOST_ASIO_HAS_IOCP
 #define TC_SOCKET_USE_IOCP
 #endif
@@ -92,7 +95,7 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef TC_SOCKET_USE_IOCP
         AsyncProcessQueue();
@@ -133,8 +136,8 @@ protected:
         _isWritingAsync = true;
 
 #ifdef TC_SOCKET_USE_IOCP
-        MessageBuffer& buffer = _writeQueue.front();
-        _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
+        PrepareGatherBuffers();
+        _socket.async_write_some(_gatherBuffers, std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_write_some(boost::asio::null_buffers(), std::bind(&Socket<T>::WriteHandlerWrapper,
@@ -144,6 +147,17 @@ protected:
         return false;
     }
 
+    /// Runs handler on the network thread owning this socket
+    template<typename Handler>
+    void PostToSocketThread(Handler&& handler)
+    {
+#if BOOST_VERSION >= 106600
+        boost::asio::post(_socket.get_executor(), std::forward<Handler>(handler));
+#else
+        _socket.get_io_service().post(std::forward<Handler>(handler));
+#endif
+    }
+
     void SetNoDelay(bool enable)
     {
         boost::system::error_code err;
@@ -154,6 +168,43 @@ protected:
     }
 
 private:
+    /// Fills _gatherBuffers with the first queued buffers, returns their total size
+    std::size_t PrepareGatherBuffers()
+    {
+        _gatherBuffers.clear();
+
+        std::size_t bytes = 0;
+        for (MessageBuffer& buffer : _writeQueue)
+        {
+            if (!buffer.GetActiveSize())
+                continue;
+
+            _gatherBuffers.emplace_back(buffer.GetReadPointer(), buffer.GetActiveSize());
+            bytes += buffer.GetActiveSize();
+            if (_gatherBuffers.size() >= WRITE_GATHER_MAX_BUFFERS)
+                break;
+        }
+
+        return bytes;
+    }
+
+    /// Removes written bytes from the front of the write queue
+    void WriteCompleted(std::size_t bytes)
+    {
+        while (!_writeQueue.empty())
+        {
+            MessageBuffer& buffer = _writeQueue.front();
+            if (bytes < buffer.GetActiveSize())
+            {
+                buffer.ReadCompleted(bytes);
+                return;
+            }
+
+            bytes -= buffer.GetActiveSize();
+            _writeQueue.pop_front();
+        }
+    }
+
     void ReadHandlerInternal(boost::system::error_code error, size_t transferredBytes)
     {
         if (error)
@@ -173,9 +224,7 @@ private:
         if (!error)
         {
             _isWritingAsync = false;
-            _writeQueue.front().ReadCompleted(transferedBytes);
-            if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+            WriteCompleted(transferedBytes);
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -199,37 +248,36 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        // several queued buffers in a single writev
+        std::size_t bytesToSend = PrepareGatherBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_gatherBuffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
                 return AsyncProcessQueue();
 
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            _writeQueue.pop_front();
             if (_closing && _writeQueue.empty())
                 CloseSocket();
             return false;
         }
         else if (bytesSent < bytesToSend) // now n > 0
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            WriteCompleted(bytesSent);
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
+        WriteCompleted(bytesSent);
         if (_closing && _writeQueue.empty())
             CloseSocket();
         return !_writeQueue.empty();
@@ -243,7 +291,8 @@ private:
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _gatherBuffers;
 
     std::atomic<bool> _closed;
     std::atomic<bool> _closing;
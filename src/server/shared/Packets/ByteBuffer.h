@@ -122,6 +122,14 @@ public:
 
     virtual ~ByteBuffer() = default;
 
+    /// Gives away storage, leaving the buffer empty
+    std::vector<uint8>&& Move()
+    {
+        _rpos = 0;
+        _wpos = 0;
+        return std::move(_storage);
+    }
+
     void clear()
     {
         _storage.clear();
@@ -31,6 +31,7 @@
 #include "IoContext.h"
 #include "Resolver.h"
 #include "World.h"
+#include "LogsDatabaseAccessor.h"
 #include "MapManager.h"
 #include "OutdoorPvPMgr.h"
 #include "InstanceSaveMgr.h"
@@ -324,6 +325,7 @@ extern int main(int argc, char **argv)
 
             ///- Clean database before leaving
             ClearOnlineAccounts();
+            sLogsDatabaseAccessor->Flush();
         });
 
         // Launch CliRunnable thread